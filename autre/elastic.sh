@@ -0,0 +1,65 @@
+#!/bin/sh
+# Table élastique : lance ./philo avec un canal de contrôle, ajoute et
+# retire des philosophes pendant la simulation, puis mesure le débit
+# (repas par seconde) et le plus long écart entre deux repas.
+#
+# ./autre/elastic.sh [nb_philo ttd tte tts] [-- commandes...]
+#   ./autre/elastic.sh 5 1200 200 200
+#   PHILO_GRAPH=autre/graphs/star_5.txt ./autre/elastic.sh 5 1500 100 100 \
+#       -- "join 2 3" "leave 1" "join 6"
+#
+# Variables : PHILO (exécutable), STEP (s entre commandes), TAIL (s après
+# la dernière commande).
+
+PHILO=${PHILO:-./philo}
+STEP=${STEP:-0.5}
+TAIL=${TAIL:-2}
+ARGS="5 1200 200 200"
+if [ $# -ge 4 ]; then
+	ARGS="$1 $2 $3 $4"
+	shift 4
+fi
+[ "$1" = "--" ] && shift
+[ $# -eq 0 ] && set -- join join join "leave 2" "leave 1" join "leave 4" join
+TTD=$(echo "$ARGS" | cut -d' ' -f2)
+
+DIR=$(mktemp -d)
+CTL="$DIR/ctl"
+LOG="$DIR/log"
+trap 'rm -rf "$DIR"' EXIT
+mkfifo "$CTL"
+
+# Sortie ligne par ligne : sinon kill perd la fin du journal, restée
+# dans le tampon de printf, et les mesures portent sur un journal tronqué.
+PHILO_CTL="$CTL" stdbuf -oL $PHILO $ARGS > "$LOG" &
+PID=$!
+# Garde un écrivain ouvert : une commande envoyée après la fin de la
+# simulation ne bloque pas le script.
+exec 3<>"$CTL"
+for cmd in "$@"; do
+	sleep "$STEP"
+	kill -0 $PID 2>/dev/null || break
+	echo "> $cmd" >&2
+	echo "$cmd" >&3
+done
+sleep "$TAIL"
+kill $PID 2>/dev/null
+wait $PID 2>/dev/null
+exec 3>&-
+
+awk -v ttd="$TTD" '
+$3 == "has" && $4 == "joined" { last[$2] = $1 }
+$3 == "is" && $4 == "eating" {
+	if ($1 - last[$2] > gap) { gap = $1 - last[$2]; who = $2 }
+	last[$2] = $1; meals[int($1 / 1000)]++
+}
+$3 == "died" { died = $0 }
+$3 == "has" && ($4 == "joined" || $4 == "left") { print "  " $0 }
+END {
+	printf "repas/s :"
+	for (s = 0; s in meals || s == 0; s++) printf " %d", meals[s]
+	printf "\nécart max entre repas : %d ms (philosophe %s, time_to_die %d)\n",
+		gap, who, ttd
+	if (died != "") print "mort : " died
+	exit (died != "" || gap > ttd)
+}' "$LOG"
@@ -0,0 +1,86 @@
+#!/bin/sh
+# Latence d'affichage des morts sous surcharge CPU : lance RUNS fois
+# ./philo pendant que des processus qui tournent à vide occupent les
+# coeurs, puis vérifie les journaux avec ./philo_verify (make verify).
+#
+# ./autre/stress.sh [nb_philo ttd tte tts [nb_meals]]
+#   ./autre/stress.sh                        # 4 310 200 100 : meurt à 310
+#   RUNS=50 LOAD=4 QUOTA=50 ./autre/stress.sh 5 800 200 200 7
+#
+# Variables :
+#   RUNS     nombre de simulations (20)
+#   LOAD     processus de charge par coeur (2)
+#   QUOTA    % d'un coeur alloué à ./philo via un cgroup (vide : aucun)
+#   TIMEOUT  durée maximale d'une simulation en s (10)
+#   KEEP     répertoire où garder les journaux (sinon supprimés)
+
+PHILO=${PHILO:-./philo}
+VERIFY=${VERIFY:-./philo_verify}
+RUNS=${RUNS:-20}
+LOAD=${LOAD:-2}
+QUOTA=${QUOTA:-}
+TIMEOUT=${TIMEOUT:-10}
+[ $# -ge 4 ] || set -- 4 310 200 100
+TTD=$2
+
+DIR=${KEEP:-$(mktemp -d)}
+mkdir -p "$DIR"
+CG=
+SPIN=
+
+cleanup() {
+	[ -n "$SPIN" ] && kill $SPIN 2>/dev/null
+	[ -n "$CG" ] && rmdir "$CG" 2>/dev/null
+	[ -z "$KEEP" ] && rm -rf "$DIR"
+}
+trap cleanup EXIT
+trap 'exit 2' INT TERM
+
+# Cgroup avec quota CPU : v2 (cpu.max) puis v1 (cpu.cfs_quota_us).
+# Il faut les droits d'écriture sur /sys/fs/cgroup (root, conteneur
+# privilégié) ; sinon la charge seule est appliquée.
+cg_setup() {
+	period=100000
+	quota=$((QUOTA * period / 100))
+	if grep -qw cpu /sys/fs/cgroup/cgroup.controllers 2>/dev/null; then
+		CG=/sys/fs/cgroup/philo_stress.$$
+		mkdir "$CG" 2>/dev/null \
+			&& echo "$quota $period" > "$CG/cpu.max" 2>/dev/null \
+			&& return 0
+	elif [ -d /sys/fs/cgroup/cpu ]; then
+		CG=/sys/fs/cgroup/cpu/philo_stress.$$
+		mkdir "$CG" 2>/dev/null \
+			&& echo $period > "$CG/cpu.cfs_period_us" \
+			&& echo $quota > "$CG/cpu.cfs_quota_us" 2>/dev/null \
+			&& return 0
+	fi
+	[ -d "$CG" ] && rmdir "$CG" 2>/dev/null
+	CG=
+	echo "stress: cgroup CPU quota unavailable, load only" >&2
+	return 1
+}
+
+[ -n "$QUOTA" ] && cg_setup
+CPUS=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+i=0
+while [ $i -lt $((LOAD * CPUS)) ]; do
+	sh -c 'while :; do :; done' &
+	SPIN="$SPIN $!"
+	i=$((i + 1))
+done
+echo "stress: $RUNS x ./philo $*, $((LOAD * CPUS)) spinner(s) on $CPUS cpu(s)${CG:+, quota $QUOTA%}" >&2
+
+# Sortie ligne par ligne : timeout tue ./philo, et une sortie mise en
+# tampon perdrait la fin du journal, là où une mort tardive apparaîtrait.
+i=1
+while [ $i -le "$RUNS" ]; do
+	if [ -n "$CG" ]; then
+		sh -c 'echo $$ > "$0/cgroup.procs" && exec "$@"' "$CG" \
+			timeout "$TIMEOUT" stdbuf -oL $PHILO "$@" > "$DIR/run_$i.log"
+	else
+		timeout "$TIMEOUT" stdbuf -oL $PHILO "$@" > "$DIR/run_$i.log"
+	fi
+	i=$((i + 1))
+done
+
+$VERIFY "$TTD" "$DIR"/run_*.log
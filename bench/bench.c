@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 09:20:47 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/25 09:20:47 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief Horloge monotone en nanosecondes
+ *
+ * Indépendante de get_time() (qui fait partie des primitives mesurées)
+ * et insensible aux réglages de l'heure système.
+ */
+long long	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+/**
+ * @brief Construit une table ronde de nb_philo philosophes, sans thread
+ *
+ * @param nb_philo Nombre de philosophes
+ * @return t_data* Table initialisée comme par ./philo, NULL en cas d'erreur
+ *
+ * time_to_die est assez grand pour qu'aucune mort ne soit détectée.
+ * La table vit jusqu'à la fin du programme.
+ */
+t_data	*bench_data(int nb_philo)
+{
+	t_data	*data;
+	char	nb[16];
+	char	*argv[6];
+
+	data = malloc(sizeof(t_data));
+	if (!data)
+		return (NULL);
+	snprintf(nb, sizeof(nb), "%d", nb_philo);
+	argv[0] = "philo_bench";
+	argv[1] = nb;
+	argv[2] = "100000000";
+	argv[3] = "1";
+	argv[4] = "1";
+	argv[5] = NULL;
+	if (!init_data(data, argv))
+	{
+		free(data);
+		return (NULL);
+	}
+	return (data);
+}
+
+/**
+ * @brief Affiche une ligne de résultats
+ *
+ * @param name Nom de la mesure
+ * @param st Statistiques de la série
+ * @param unit Unité des valeurs (ns/op, us...)
+ */
+void	bench_line(const char *name, t_stat *st, const char *unit)
+{
+	printf("%-26s %11.1f %11.1f %9.1f %11.1f %3d/%-3d %s\n", name, st->median,
+		st->mean, st->stddev, st->min, st->kept, st->runs, unit);
+}
+
+/**
+ * @brief Lance les mesures dont le groupe contient filter
+ *
+ * ./philo_bench [filtre] : time, usleep, print, fork, scan.
+ * PHILO_GRAPH et PHILO_CTL sont ignorés : les mesures utilisent
+ * toujours la table ronde, sans canal de contrôle.
+ */
+int	main(int argc, char **argv)
+{
+	const char	*filter;
+
+	filter = "";
+	if (argc > 1)
+		filter = argv[1];
+	unsetenv("PHILO_GRAPH");
+	unsetenv("PHILO_CTL");
+	printf("%-26s %11s %11s %9s %11s %7s\n", "primitive", "median",
+		"mean", "stddev", "min", "kept");
+	if (strstr("time", filter))
+		bench_time();
+	if (strstr("usleep", filter))
+		bench_usleep();
+	if (strstr("print", filter))
+		bench_print();
+	if (strstr("fork", filter))
+		bench_fork();
+	if (strstr("scan", filter))
+		bench_scan();
+	return (0);
+}
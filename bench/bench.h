@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 09:14:02 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/25 09:14:02 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "../include/philo.h"
+
+/* Échantillons par mesure, durée minimale d'un échantillon (ns) */
+# define BENCH_RUNS 31
+# define BENCH_MIN_NS 2000000
+/* Rejet des échantillons à plus de BENCH_MAD_K écarts robustes (MAD) */
+# define BENCH_MAD_K 3.0
+/* Threads au plus pour les mesures concurrentes */
+# define BENCH_MAX_THREADS 64
+
+/* Résumé d'une série d'échantillons, après rejet des valeurs aberrantes */
+typedef struct s_stat
+{
+	double	median;
+	double	mean;
+	double	stddev;
+	double	min;
+	int		kept;
+	int		runs;
+}			t_stat;
+
+/*
+ * Une mesure : exécute *ops opérations et renvoie la durée en ns.
+ * Peut arrondir *ops au nombre réellement exécuté (répartition en threads).
+ */
+typedef long long	(*t_bench_fn)(void *ctx, long *ops);
+
+/* Travail d'un thread pour les mesures concurrentes */
+typedef struct s_job
+{
+	t_data				*data;
+	int					index;
+	long				ops;
+	void				(*work)(struct s_job *job);
+	pthread_barrier_t	*start;
+	long long			t0;
+	long long			t1;
+}						t_job;
+
+/* bench.c */
+long long	bench_now(void);
+t_data		*bench_data(int nb_philo);
+void		bench_line(const char *name, t_stat *st, const char *unit);
+
+/* bench_stat.c */
+void		bench_stat(double *v, int n, t_stat *st);
+void		bench_measure(t_bench_fn fn, void *ctx, t_stat *st);
+long long	bench_spawn(t_job *jobs, int nb);
+
+/* bench_time.c */
+void		bench_time(void);
+void		bench_usleep(void);
+
+/* bench_print.c */
+void		bench_print(void);
+
+/* bench_fork.c */
+void		bench_fork(void);
+
+/* bench_scan.c */
+void		bench_scan(void);
+
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_fork.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 11:05:19 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/25 11:05:19 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+typedef struct s_fork
+{
+	t_data	*data;
+	int		threads;
+}			t_fork;
+
+/**
+ * @brief Un repas sans attente : le protocole de take_forks() et eat()
+ *
+ * Verrouille les fourchettes du philosophe par index décroissant (ordre
+ * global), puis les rend dans l'ordre croissant, sans affichage ni
+ * ft_usleep().
+ */
+static void	fork_meal(t_data *data, t_philo *philo)
+{
+	int	i;
+
+	i = philo->nb_res;
+	while (i-- > 0)
+		pthread_mutex_lock(fork_at(data, philo->res[i]));
+	i = 0;
+	while (i < philo->nb_res)
+		pthread_mutex_unlock(fork_at(data, philo->res[i++]));
+}
+
+static void	fork_job(t_job *job)
+{
+	t_philo	*philo;
+	long	i;
+
+	philo = philo_at(job->data, job->index);
+	i = 0;
+	while (i++ < job->ops)
+		fork_meal(job->data, philo);
+}
+
+static long long	fork_run(void *ctx, long *ops)
+{
+	t_fork	*f;
+	t_job	jobs[BENCH_MAX_THREADS];
+	long	per;
+	int		i;
+
+	f = (t_fork *)ctx;
+	per = *ops / f->threads + 1;
+	i = -1;
+	while (++i < f->threads)
+	{
+		jobs[i].data = f->data;
+		jobs[i].index = i;
+		jobs[i].ops = per;
+		jobs[i].work = fork_job;
+	}
+	*ops = per * f->threads;
+	return (bench_spawn(jobs, f->threads));
+}
+
+/**
+ * @brief Prise et rendu des deux fourchettes, seul puis en concurrence
+ *
+ * - "forks alone" : un seul philosophe d'une table de deux, les mutex
+ *   ne sont jamais disputés (coût minimal lock/unlock x2)
+ * - "forks ring N" : N threads sur une table ronde de N ; chaque
+ *   fourchette passe d'un voisin à l'autre, ns/op est le temps mur par
+ *   repas, transferts de cache et réveils compris
+ */
+void	bench_fork(void)
+{
+	static const int	threads[] = {2, 4, 16, 64};
+	t_fork				f;
+	t_stat				st;
+	char				name[32];
+	int					k;
+
+	f.data = bench_data(2);
+	if (!f.data)
+		return ;
+	f.threads = 1;
+	bench_measure(fork_run, &f, &st);
+	bench_line("forks alone", &st, "ns/op");
+	k = -1;
+	while (++k < 4)
+	{
+		f.data = bench_data(threads[k]);
+		if (!f.data)
+			return ;
+		f.threads = threads[k];
+		bench_measure(fork_run, &f, &st);
+		snprintf(name, sizeof(name), "forks ring %d", threads[k]);
+		bench_line(name, &st, "ns/op");
+	}
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_print.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 10:27:55 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/25 10:27:55 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <fcntl.h>
+
+typedef struct s_print
+{
+	t_data	*data;
+	int		threads;
+}			t_print;
+
+static void	print_job(t_job *job)
+{
+	t_philo	*philo;
+	long	i;
+
+	philo = philo_at(job->data, job->index);
+	i = 0;
+	while (i++ < job->ops)
+		print_status(philo, "is thinking");
+}
+
+static long long	print_run(void *ctx, long *ops)
+{
+	t_print	*p;
+	t_job	jobs[BENCH_MAX_THREADS];
+	long	per;
+	int		i;
+
+	p = (t_print *)ctx;
+	per = *ops / p->threads + 1;
+	i = -1;
+	while (++i < p->threads)
+	{
+		jobs[i].data = p->data;
+		jobs[i].index = i;
+		jobs[i].ops = per;
+		jobs[i].work = print_job;
+	}
+	*ops = per * p->threads;
+	return (bench_spawn(jobs, p->threads));
+}
+
+/**
+ * @brief Débit de print_status() avec 1, 4, 16 et 64 threads
+ *
+ * Chaque thread affiche pour son propre philosophe : ns/op est le temps
+ * mur divisé par le nombre total de lignes, donc l'inverse du débit
+ * global. stdout est redirigé vers /dev/null pendant la mesure ; comme
+ * pour ./philo > fichier, printf est alors mis en tampon par bloc.
+ */
+void	bench_print(void)
+{
+	static const int	threads[] = {1, 4, 16, 64};
+	t_stat				st[4];
+	t_print				p;
+	char				name[32];
+	int					fd[2];
+	int					k;
+
+	p.data = bench_data(BENCH_MAX_THREADS);
+	if (!p.data)
+		return ;
+	fflush(stdout);
+	fd[0] = dup(STDOUT_FILENO);
+	fd[1] = open("/dev/null", O_WRONLY);
+	dup2(fd[1], STDOUT_FILENO);
+	close(fd[1]);
+	k = -1;
+	while (++k < 4)
+	{
+		p.threads = threads[k];
+		bench_measure(print_run, &p, &st[k]);
+	}
+	fflush(stdout);
+	dup2(fd[0], STDOUT_FILENO);
+	close(fd[0]);
+	k = -1;
+	while (++k < 4)
+	{
+		snprintf(name, sizeof(name), "print_status x%d", threads[k]);
+		bench_line(name, &st[k], "ns/op");
+	}
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 11:38:42 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/25 11:38:42 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static long long	scan_run(void *ctx, long *ops)
+{
+	t_data		*data;
+	long long	t0;
+	long		i;
+	int			hungry;
+
+	data = (t_data *)ctx;
+	t0 = bench_now();
+	i = 0;
+	while (i++ < *ops)
+		check_death(data, &hungry);
+	return (bench_now() - t0);
+}
+
+/**
+ * @brief Un tour complet de check_death() selon le nombre de philosophes
+ *
+ * Personne ne meurt : chaque appel scanne toute la table avec le kernel
+ * choisi par scan_init() (le même que ./philo sur cette machine).
+ */
+void	bench_scan(void)
+{
+	static const int	sizes[] = {1, 16, 200, 4096, 65536};
+	t_data				*data;
+	t_stat				st;
+	char				name[32];
+	int					k;
+
+	k = -1;
+	while (++k < (int)(sizeof(sizes) / sizeof(*sizes)))
+	{
+		data = bench_data(sizes[k]);
+		if (!data)
+			return ;
+		bench_measure(scan_run, data, &st);
+		snprintf(name, sizeof(name), "check_death N=%d", sizes[k]);
+		bench_line(name, &st, "ns/op");
+	}
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_stat.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 09:41:13 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/25 09:41:13 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <math.h>
+
+static int	cmp_double(const void *a, const void *b)
+{
+	double	x;
+	double	y;
+
+	x = *(const double *)a;
+	y = *(const double *)b;
+	return ((x > y) - (x < y));
+}
+
+/**
+ * @brief Médiane d'un tableau (trié en place)
+ */
+static double	median(double *v, int n)
+{
+	qsort(v, n, sizeof(double), cmp_double);
+	if (n % 2)
+		return (v[n / 2]);
+	return ((v[n / 2 - 1] + v[n / 2]) / 2);
+}
+
+/**
+ * @brief Résume une série d'échantillons en rejetant les valeurs aberrantes
+ *
+ * @param v Échantillons (au plus BENCH_RUNS), non modifiés
+ * @param n Nombre d'échantillons
+ * @param st Reçoit médiane, moyenne, écart-type et minimum
+ *
+ * Rejet robuste : un échantillon est gardé s'il est à moins de
+ * BENCH_MAD_K * 1.4826 * MAD de la médiane (MAD = médiane des écarts
+ * absolus ; 1.4826 le ramène à un écart-type pour une loi normale).
+ * Une préemption ou une migration de CPU pendant un échantillon ne
+ * fausse ainsi ni la moyenne ni l'écart-type. Si MAD vaut 0 (valeurs
+ * quantifiées), tous les échantillons sont gardés.
+ */
+void	bench_stat(double *v, int n, t_stat *st)
+{
+	double	tmp[BENCH_RUNS];
+	double	sum;
+	double	limit;
+	int		i;
+
+	i = -1;
+	while (++i < n)
+		tmp[i] = v[i];
+	st->median = median(tmp, n);
+	st->min = tmp[0];
+	while (i-- > 0)
+		tmp[i] = fabs(v[i] - st->median);
+	limit = BENCH_MAD_K * 1.4826 * median(tmp, n);
+	sum = 0;
+	st->kept = 0;
+	while (++i < n)
+	{
+		if (limit == 0 || fabs(v[i] - st->median) <= limit)
+		{
+			sum += v[i];
+			st->kept++;
+		}
+	}
+	st->mean = sum / st->kept;
+	sum = 0;
+	while (i-- > 0)
+		if (limit == 0 || fabs(v[i] - st->median) <= limit)
+			sum += (v[i] - st->mean) * (v[i] - st->mean);
+	st->stddev = sqrt(sum / st->kept);
+	st->runs = n;
+}
+
+/**
+ * @brief Calibre puis mesure une primitive en ns par opération
+ *
+ * @param fn Mesure à répéter
+ * @param ctx Contexte passé à fn
+ * @param st Reçoit les statistiques en ns/op
+ *
+ * Le nombre d'opérations double jusqu'à ce qu'un échantillon dure au
+ * moins BENCH_MIN_NS : la résolution de l'horloge devient négligeable,
+ * et la calibration sert d'échauffement (caches, fréquence CPU).
+ */
+void	bench_measure(t_bench_fn fn, void *ctx, t_stat *st)
+{
+	double		v[BENCH_RUNS];
+	long long	ns;
+	long		ops;
+	long		n;
+	int			i;
+
+	n = 1;
+	ops = n;
+	while (fn(ctx, &ops) < BENCH_MIN_NS)
+	{
+		n *= 2;
+		ops = n;
+	}
+	i = 0;
+	while (i < BENCH_RUNS)
+	{
+		ops = n;
+		ns = fn(ctx, &ops);
+		v[i++] = (double)ns / ops;
+	}
+	bench_stat(v, BENCH_RUNS, st);
+}
+
+static void	*bench_job(void *arg)
+{
+	t_job	*job;
+
+	job = (t_job *)arg;
+	pthread_barrier_wait(job->start);
+	job->t0 = bench_now();
+	job->work(job);
+	job->t1 = bench_now();
+	return (NULL);
+}
+
+/**
+ * @brief Lance nb threads et chronomètre leur travail
+ *
+ * @param jobs Travail de chaque thread (job->work)
+ * @param nb Nombre de threads
+ * @return long long Durée en ns entre le premier départ et la dernière
+ *                   arrivée
+ *
+ * Tous les threads partent d'une même barrière et datent eux-mêmes leur
+ * travail : ni la création des threads ni une préemption du thread
+ * principal ne sont chronométrées. Un échec de création laisserait les
+ * autres bloqués : le programme s'arrête.
+ */
+long long	bench_spawn(t_job *jobs, int nb)
+{
+	pthread_barrier_t	start;
+	pthread_t			th[BENCH_MAX_THREADS];
+	long long			first;
+	long long			last;
+	int					i;
+
+	if (nb > BENCH_MAX_THREADS || pthread_barrier_init(&start, NULL, nb))
+		exit(1);
+	i = -1;
+	while (++i < nb)
+	{
+		jobs[i].start = &start;
+		if (pthread_create(&th[i], NULL, bench_job, &jobs[i]))
+			exit(1);
+	}
+	first = LLONG_MAX;
+	last = 0;
+	while (i-- > 0)
+	{
+		pthread_join(th[i], NULL);
+		if (jobs[i].t0 < first)
+			first = jobs[i].t0;
+		if (jobs[i].t1 > last)
+			last = jobs[i].t1;
+	}
+	pthread_barrier_destroy(&start);
+	return (last - first);
+}
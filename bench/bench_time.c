@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_time.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 10:02:38 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/25 10:02:38 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static long long	time_get(void *ctx, long *ops)
+{
+	volatile long long	sink;
+	long long			t0;
+	long				i;
+
+	(void)ctx;
+	t0 = bench_now();
+	i = 0;
+	while (i++ < *ops)
+		sink = get_time();
+	(void)sink;
+	return (bench_now() - t0);
+}
+
+/**
+ * @brief Coût d'un appel à get_time()
+ */
+void	bench_time(void)
+{
+	t_stat	st;
+
+	bench_measure(time_get, NULL, &st);
+	bench_line("get_time", &st, "ns/op");
+}
+
+/**
+ * @brief Précision de ft_usleep() : retard sur la durée demandée
+ *
+ * Chaque échantillon est un seul appel, chronométré avec l'horloge
+ * monotone. Le retard (µs) mesure l'arrondi de get_time() à la
+ * milliseconde et le pas de usleep(100) ; une valeur négative signifie
+ * que ft_usleep() a rendu la main trop tôt.
+ */
+void	bench_usleep(void)
+{
+	static const int	ms[] = {1, 2, 5, 10, 50};
+	double				v[BENCH_RUNS];
+	char				name[32];
+	t_stat				st;
+	long long			t0;
+	int					k;
+	int					i;
+
+	k = -1;
+	while (++k < (int)(sizeof(ms) / sizeof(*ms)))
+	{
+		i = -1;
+		while (++i < BENCH_RUNS)
+		{
+			t0 = bench_now();
+			ft_usleep(ms[k]);
+			v[i] = (bench_now() - t0 - ms[k] * 1000000LL) / 1000.0;
+		}
+		bench_stat(v, BENCH_RUNS, &st);
+		snprintf(name, sizeof(name), "ft_usleep(%d) late", ms[k]);
+		bench_line(name, &st, "us");
+	}
+}
@@ -13,12 +13,78 @@
 #ifndef PHILO_H
 # define PHILO_H
 
+# include <limits.h>
 # include <pthread.h>
 # include <stdio.h>
 # include <stdlib.h>
 # include <sys/time.h>
 # include <unistd.h>
 
+/* Phases de la simulation mesurées par l'instrumentation (make perf) */
+typedef enum e_phase
+{
+	PH_OTHER,
+	PH_FORKS,
+	PH_EAT,
+	PH_DREAM,
+	PH_LOG,
+	PH_MONITOR,
+	PH_COUNT
+}					t_phase;
+
+/* Compteurs : cycles|task_ns, instructions, cache-misses, ctx-switches, wall */
+# define PERF_NB_VAL 5
+# define PERF_NB_FD 4
+
+typedef struct s_perf
+{
+	int				level;
+	int				nb_fd;
+	int				fd[PERF_NB_FD];
+	t_phase			phase;
+	long long		last[PERF_NB_VAL];
+	long long		acc[PH_COUNT][PERF_NB_VAL];
+}					t_perf;
+
+/* Alignement et granularité des tableaux scannés par le monitor */
+# define SCAN_ALIGN 64
+# define SCAN_PAD 16
+
+/*
+ * Paramètres et résultat d'un scan des échéances :
+ * times[i] = dernier repas en ms depuis start_time, meals[i] = repas pris,
+ * n multiple de SCAN_PAD, expiré si times[i] < limit, fini si meals[i] > goal
+ */
+typedef struct s_scan
+{
+	const int		*times;
+	const int		*meals;
+	int				n;
+	int				limit;
+	int				goal;
+	int				finished;
+}					t_scan;
+
+typedef int			(*t_scan_fn)(t_scan *scan);
+
+/*
+ * Stockage par blocs (philosophes, fourchettes, tableaux du scan) :
+ * un bloc alloué ne bouge plus, grandir revient à ajouter un bloc
+ */
+# define CHUNK_SIZE 1024
+# define CHUNK_MAX 1024
+
+/* Canal de contrôle (PHILO_CTL) : taille d'une ligne de commande */
+# define CTL_BUF 4096
+# define CTL_MAX_IDS 64
+
+/* Listes de fourchettes remplacées, libérées à la fin de la simulation */
+typedef struct s_retired
+{
+	void				*ptr;
+	struct s_retired	*next;
+}					t_retired;
+
 typedef struct s_philo
 {
 	int				id;
@@ -27,24 +93,47 @@ typedef struct s_philo
 	long long		last_meal_time;
 	pthread_mutex_t	meal_mutex;
 	pthread_t		thread;
-	pthread_mutex_t	*left_fork;
-	pthread_mutex_t	*right_fork;
+	int				*res;
+	int				nb_res;
+	int				res_own;
+	int				*held;
+	int				nb_held;
+	int				prev;
+	int				next;
+	int				leaving;
+	int				gone;
+	t_perf			perf;
 	struct s_data	*data;
 }					t_philo;
 
 typedef struct s_data
 {
 	int				nb_philo;
+	int				nb_active;
 	int				time_to_die;
 	int				time_to_eat;
 	int				time_to_sleep;
 	int				nb_meals;
 	int				dead;
 	long long		start_time;
-	pthread_mutex_t	*forks;
+	int				ring;
+	int				ring_head;
+	int				odd_cycle;
+	int				nb_forks;
+	int				*res_off;
+	int				*res_idx;
+	pthread_mutex_t	*forks[CHUNK_MAX];
 	pthread_mutex_t	print_mutex;
 	pthread_mutex_t	dead_mutex;
-	t_philo			*philos;
+	t_philo			*philos[CHUNK_MAX];
+	int				*meal_times[CHUNK_MAX];
+	int				*meal_counts[CHUNK_MAX];
+	t_scan_fn		scan;
+	const char		*ctl_path;
+	int				ctl_fd;
+	pthread_t		ctl_thread;
+	t_retired		*retired;
+	t_perf			perf;
 }					t_data;
 
 /* utils.c */
@@ -52,18 +141,81 @@ int					ft_atoi(const char *str);
 long long			get_time(void);
 void				ft_usleep(int ms);
 void				print_status(t_philo *philo, char *status);
+void				print_event(t_data *data, int id, char *status);
+void				print_line(t_data *data, int id, char *status);
 
 /* init.c */
 int					init_data(t_data *data, char **argv);
 int					init_philos(t_data *data);
 int					init_forks(t_data *data);
 
+/* table.c */
+t_philo				*philo_at(t_data *data, int i);
+pthread_mutex_t		*fork_at(t_data *data, int f);
+int					table_philos(t_data *data, int n);
+int					table_forks(t_data *data, int first, int n);
+
+/* graph.c */
+int					init_graph(t_data *data);
+
+/* graph_csr.c */
+int					graph_build(t_data *data, int *edges, int nb_edges);
+
 /* philo.c */
 void				*philo_routine(void *arg);
 int					start_simulation(t_data *data);
 
 /* monitor.c */
-int					check_death(t_data *data);
-int					check_meals(t_data *data);
+int					check_death(t_data *data, int *hungry);
+int					check_meals(t_data *data, int hungry);
+
+/* scan.c */
+int					scan_scalar(t_scan *scan);
+void				scan_init(t_data *data);
+int					scan_all(t_data *data, t_scan *scan);
+void				scan_publish(t_philo *philo);
+
+/* scan_x86.c */
+# if defined(__x86_64__)
+
+int					scan_sse2(t_scan *scan);
+int					scan_avx2(t_scan *scan);
+int					scan_avx512(t_scan *scan);
+# endif
+
+/* ctl.c */
+void				ctl_start(t_data *data);
+void				ctl_stop(t_data *data);
+
+/* ctl_cmd.c */
+void				ctl_exec(t_data *data, char *line);
+
+/* ctl_join.c */
+int					ctl_join(t_data *data, int *ids, int nb);
+int					ctl_leave(t_data *data, int i);
+
+/* ctl_ring.c */
+int					ring_join(t_data *data, int n);
+int					ring_leave(t_data *data, int x);
+
+/* ctl_link.c */
+int					link_fork(t_data *data);
+int					link_common(t_philo *a, t_philo *b);
+void				link_wait(t_data *data, const int *res, int nb);
+int					link_add(t_data *data, int a, int b);
+
+/* ctl_res.c */
+int					res_has(t_philo *philo, int f);
+int					res_edit(t_data *data, t_philo *philo, int add, int del);
+
+/* perf.c */
+void				perf_open(t_perf *perf);
+void				perf_close(t_perf *perf);
+
+/* perf_read.c */
+t_phase				perf_enter(t_perf *perf, t_phase phase);
+
+/* perf_report.c */
+void				perf_report(t_data *data);
 
 #endif
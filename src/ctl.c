@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ctl.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 15:02:31 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/23 15:02:31 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static int	ctl_done(t_data *data)
+{
+	int	dead;
+
+	pthread_mutex_lock(&data->dead_mutex);
+	dead = data->dead;
+	pthread_mutex_unlock(&data->dead_mutex);
+	return (dead);
+}
+
+/**
+ * @brief Lit le canal et exécute chaque ligne complète
+ *
+ * @param data Structure principale
+ * @param buf Tampon de lignes (CTL_BUF octets)
+ * @param len Octets déjà en attente dans buf
+ * @return int Octets restant en attente (ligne incomplète)
+ *
+ * Une ligne plus longue que le tampon est ignorée.
+ */
+static int	ctl_read(t_data *data, char *buf, int len)
+{
+	char	*nl;
+	int		r;
+
+	r = read(data->ctl_fd, buf + len, CTL_BUF - 1 - len);
+	if (r <= 0)
+		return (len);
+	len += r;
+	buf[len] = '\0';
+	nl = strchr(buf, '\n');
+	while (nl)
+	{
+		*nl = '\0';
+		ctl_exec(data, buf);
+		len -= nl + 1 - buf;
+		memmove(buf, nl + 1, len + 1);
+		nl = strchr(buf, '\n');
+	}
+	if (len == CTL_BUF - 1)
+		len = 0;
+	return (len);
+}
+
+/**
+ * @brief Thread du canal de contrôle
+ *
+ * Attend les commandes par tranches de 50 ms pour remarquer la fin de
+ * la simulation. C'est le seul thread qui ajoute ou retire des
+ * philosophes et des fourchettes.
+ */
+static void	*ctl_routine(void *arg)
+{
+	t_data			*data;
+	struct pollfd	pfd;
+	char			buf[CTL_BUF];
+	int				len;
+
+	data = (t_data *)arg;
+	pfd.fd = data->ctl_fd;
+	pfd.events = POLLIN;
+	len = 0;
+	while (!ctl_done(data))
+		if (poll(&pfd, 1, 50) > 0)
+			len = ctl_read(data, buf, len);
+	return (NULL);
+}
+
+/**
+ * @brief Ouvre le canal de contrôle si PHILO_CTL est défini
+ *
+ * @param data Structure principale, philosophes initiaux déjà lancés
+ *
+ * PHILO_CTL désigne une FIFO, créée si besoin. Elle est ouverte en
+ * lecture-écriture : le thread garde lui-même un écrivain, les clients
+ * (echo join > fifo) peuvent aller et venir sans fin de fichier.
+ * En cas d'échec, la simulation continue sans canal.
+ */
+void	ctl_start(t_data *data)
+{
+	const char	*path;
+	struct stat	st;
+
+	path = getenv("PHILO_CTL");
+	if (!path || !*path)
+		return ;
+	if (mkfifo(path, 0600) && errno != EEXIST)
+		data->ctl_fd = -1;
+	else
+		data->ctl_fd = open(path, O_RDWR | O_NONBLOCK);
+	if (data->ctl_fd >= 0 && fstat(data->ctl_fd, &st) == 0
+		&& S_ISFIFO(st.st_mode)
+		&& pthread_create(&data->ctl_thread, NULL, ctl_routine, data) == 0)
+	{
+		data->ctl_path = path;
+		return ;
+	}
+	if (data->ctl_fd >= 0)
+		close(data->ctl_fd);
+	fprintf(stderr, "ctl: cannot use %s as a control FIFO\n", path);
+}
+
+/**
+ * @brief Attend la fin du thread de contrôle (après la fin de simulation)
+ */
+void	ctl_stop(t_data *data)
+{
+	if (!data->ctl_path)
+		return ;
+	pthread_join(data->ctl_thread, NULL);
+	close(data->ctl_fd);
+}
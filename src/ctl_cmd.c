@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ctl_cmd.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 14:18:09 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/23 14:18:09 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+#include <string.h>
+
+/**
+ * @brief Lit les identifiants qui suivent une commande
+ *
+ * @param s Fin de la ligne après le mot-clé
+ * @param ids Reçoit les identifiants convertis en index (base 0)
+ * @param max Nombre maximal d'identifiants
+ * @return int Nombre d'identifiants, -1 si la ligne est invalide
+ */
+static int	ctl_parse(char *s, int *ids, int max)
+{
+	int	nb;
+
+	nb = 0;
+	while (*s)
+	{
+		if (*s >= '0' && *s <= '9')
+		{
+			if (nb == max)
+				return (-1);
+			ids[nb++] = ft_atoi(s) - 1;
+			while (*s >= '0' && *s <= '9')
+				s++;
+		}
+		else if (*s == ' ' || *s == '\t' || *s == '\r')
+			s++;
+		else
+			return (-1);
+	}
+	return (nb);
+}
+
+/**
+ * @brief Vérifie que tous les identifiants désignent un philosophe présent
+ */
+static int	ctl_valid(t_data *data, int *ids, int nb)
+{
+	int	i;
+
+	i = 0;
+	while (i < nb)
+	{
+		if (ids[i] < 0 || ids[i] >= data->nb_philo
+			|| philo_at(data, ids[i])->gone)
+			return (0);
+		i++;
+	}
+	return (nb >= 0);
+}
+
+/**
+ * @brief Exécute une ligne reçue sur le canal de contrôle
+ *
+ * @param data Structure principale
+ * @param line Ligne sans '\n'
+ *
+ * Commandes (identifiants comme à l'affichage) :
+ * - "join"          table ronde : un philosophe de plus en bout de table
+ * - "join a b ..."  graphe : un philosophe relié à a, b, ...
+ * - "leave a"       le philosophe a quitte la table
+ * Une commande refusée est signalée sur stderr, la simulation continue.
+ */
+void	ctl_exec(t_data *data, char *line)
+{
+	int	ids[CTL_MAX_IDS];
+	int	nb;
+	int	ok;
+
+	ok = 0;
+	if (strncmp(line, "join", 4) == 0)
+	{
+		nb = ctl_parse(line + 4, ids, CTL_MAX_IDS);
+		if (ctl_valid(data, ids, nb) && !(data->ring && nb > 0))
+			ok = ctl_join(data, ids, nb);
+	}
+	else if (strncmp(line, "leave", 5) == 0)
+	{
+		nb = ctl_parse(line + 5, ids, 1);
+		if (nb == 1 && ctl_valid(data, ids, nb))
+			ok = ctl_leave(data, ids[0]);
+	}
+	else if (line[strspn(line, " \t\r")] == '\0')
+		ok = 1;
+	if (!ok)
+		fprintf(stderr, "ctl: rejected: %s\n", line);
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ctl_join.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 11:31:44 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/23 11:31:44 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+#include <string.h>
+
+/**
+ * @brief Prépare et publie une nouvelle case de philosophe
+ *
+ * @param data Structure principale
+ * @return t_philo* Le nouveau philosophe (thread pas encore créé),
+ *                  NULL si la capacité ou la mémoire manque
+ *
+ * Sa case du scan est écrite avant la publication de nb_philo (release) :
+ * le monitor ne peut pas le voir à moitié initialisé. Il arrive rassasié
+ * de rien : dernier repas = maintenant, 0 repas.
+ */
+static t_philo	*philo_spawn(t_data *data)
+{
+	t_philo	*philo;
+	int		i;
+
+	i = data->nb_philo;
+	if (!table_philos(data, i + 1))
+		return (NULL);
+	philo = philo_at(data, i);
+	memset(philo, 0, sizeof(*philo));
+	if (pthread_mutex_init(&philo->meal_mutex, NULL))
+		return (NULL);
+	philo->id = i + 1;
+	philo->data = data;
+	philo->last_meal_time = get_time();
+	philo->prev = i;
+	philo->next = i;
+	scan_publish(philo);
+	__atomic_store_n(&data->nb_philo, i + 1, __ATOMIC_RELEASE);
+	__atomic_add_fetch(&data->nb_active, 1, __ATOMIC_RELEASE);
+	return (philo);
+}
+
+/**
+ * @brief Annonce l'arrivée d'un philosophe dont le thread vient d'être créé
+ *
+ * @param data Structure principale, print_mutex tenu par l'appelant
+ * @param philo Nouveau philosophe, bloqué avant sa première ligne
+ *
+ * Son dernier repas est remis à l'heure après l'affichage : l'instant
+ * affiché de "has joined" n'est jamais postérieur à celui dont part son
+ * échéance.
+ */
+static void	philo_arrive(t_data *data, t_philo *philo)
+{
+	print_line(data, philo->id, "has joined");
+	pthread_mutex_lock(&philo->meal_mutex);
+	philo->last_meal_time = get_time();
+	scan_publish(philo);
+	pthread_mutex_unlock(&philo->meal_mutex);
+}
+
+/**
+ * @brief Sort définitivement un philosophe dont le thread est arrêté (ou
+ * n'a pas pu être créé)
+ *
+ * @param data Structure principale
+ * @param philo Philosophe à retirer
+ *
+ * Sa case du scan est neutralisée avant la baisse de nb_active : le
+ * monitor ne peut ni le déclarer mort ni le compter rassasié à tort.
+ */
+static void	philo_retire(t_data *data, t_philo *philo)
+{
+	pthread_mutex_lock(&philo->meal_mutex);
+	philo->leaving = 1;
+	scan_publish(philo);
+	pthread_mutex_unlock(&philo->meal_mutex);
+	philo->gone = 1;
+	__atomic_sub_fetch(&data->nb_active, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Ajoute un philosophe pendant la simulation
+ *
+ * @param data Structure principale
+ * @param ids Voisins (index base 0, valides) avec qui partager une
+ *            fourchette ; ignorés sur la table ronde
+ * @param nb Nombre de voisins
+ * @return int 1 si le philosophe mange désormais, 0 en cas d'erreur
+ *
+ * Table ronde : inséré entre le dernier et le premier (ring_join()).
+ * Graphe : une nouvelle fourchette par voisin demandé. Relié à deux
+ * voisins ou plus, il peut fermer un cycle impair : le délai d'équité de
+ * think() est alors activé par prudence, sans refaire le test de
+ * bipartition.
+ * Le thread est créé sous print_mutex : "has joined" n'apparaît que
+ * s'il existe, et toujours avant sa première ligne. S'il ne peut pas
+ * être créé, la table ronde est refermée (ring_leave()).
+ */
+int	ctl_join(t_data *data, int *ids, int nb)
+{
+	t_philo	*philo;
+	int		linked;
+	int		ok;
+	int		i;
+
+	philo = philo_spawn(data);
+	if (!philo)
+		return (0);
+	ok = 1;
+	if (data->ring)
+		ok = ring_join(data, philo->id - 1);
+	linked = data->ring && ok;
+	i = 0;
+	while (ok && !data->ring && i < nb)
+		ok = link_add(data, philo->id - 1, ids[i++]);
+	if (ok && !data->ring && nb >= 2)
+		__atomic_store_n(&data->odd_cycle, 1, __ATOMIC_RELAXED);
+	pthread_mutex_lock(&data->print_mutex);
+	if (ok)
+		ok = (pthread_create(&philo->thread, NULL, philo_routine, philo) == 0);
+	if (ok)
+		philo_arrive(data, philo);
+	pthread_mutex_unlock(&data->print_mutex);
+	if (ok)
+		return (1);
+	philo_retire(data, philo);
+	if (linked)
+		ring_leave(data, philo->id - 1);
+	return (0);
+}
+
+/**
+ * @brief Retire le philosophe d'index i pendant la simulation
+ *
+ * @param data Structure principale
+ * @param i Index (base 0) d'un philosophe présent
+ * @return int 1 si le philosophe est parti, 0 s'il est le dernier ou en
+ *             cas d'erreur
+ *
+ * Sa case du scan est neutralisée tout de suite : un partant bloqué sur
+ * ses fourchettes ne masque pas les autres échéances au monitor. Il
+ * finit son cycle (il rend ses fourchettes) puis sort de sa boucle ; les
+ * autres continuent pendant l'attente. Table ronde : ses
+ * voisins sont reliés (ring_leave()). Graphe : ses fourchettes restent
+ * chez ses voisins, qui n'ont simplement plus de concurrent.
+ */
+int	ctl_leave(t_data *data, int i)
+{
+	t_philo	*philo;
+
+	if (data->nb_active <= 1)
+		return (0);
+	philo = philo_at(data, i);
+	pthread_mutex_lock(&philo->meal_mutex);
+	philo->leaving = 1;
+	scan_publish(philo);
+	pthread_mutex_unlock(&philo->meal_mutex);
+	pthread_join(philo->thread, NULL);
+	philo_retire(data, philo);
+	print_event(data, philo->id, "has left");
+	if (data->ring)
+		return (ring_leave(data, i));
+	return (1);
+}
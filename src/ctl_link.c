@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ctl_link.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 14:40:03 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/22 14:40:03 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/**
+ * @brief Crée une nouvelle fourchette, non encore publiée
+ *
+ * @param data Structure principale
+ * @return int Index de la fourchette, -1 en cas d'erreur
+ *
+ * Elle prend le plus grand index : ajoutée en fin de liste, elle ne
+ * casse pas l'ordre global. Son mutex est initialisé avant d'être
+ * publié dans une liste.
+ */
+int	link_fork(t_data *data)
+{
+	int	f;
+
+	f = data->nb_forks;
+	if (!table_forks(data, f, f + 1))
+		return (-1);
+	data->nb_forks = f + 1;
+	return (f);
+}
+
+/**
+ * @brief Première fourchette que a partage avec b, -1 s'il n'y en a pas
+ *
+ * Lecture sans verrou : seul le thread de contrôle modifie les listes.
+ */
+int	link_common(t_philo *a, t_philo *b)
+{
+	int	i;
+
+	i = 0;
+	while (i < a->nb_res)
+	{
+		if (res_has(b, a->res[i]))
+			return (a->res[i]);
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Attend la fin des repas qui tiennent l'une des fourchettes res
+ *
+ * @param data Structure principale
+ * @param res Fourchettes à attendre, triées
+ * @param nb Nombre de fourchettes
+ *
+ * À appeler après la publication des nouvelles listes. Un repas validé
+ * avant la publication tient toute son ancienne liste : prendre puis
+ * rendre ses fourchettes, par index décroissant, attend qu'il se
+ * termine. Aucun repas ne démarre plus sur une ancienne liste
+ * (forks_grab()).
+ */
+void	link_wait(t_data *data, const int *res, int nb)
+{
+	while (nb-- > 0)
+	{
+		pthread_mutex_lock(fork_at(data, res[nb]));
+		pthread_mutex_unlock(fork_at(data, res[nb]));
+	}
+}
+
+/**
+ * @brief Crée une fourchette partagée par les philosophes a et b
+ *
+ * @param data Structure principale
+ * @param a Index du premier philosophe
+ * @param b Index du second (a == b : fourchette propre à a)
+ * @return int 1 si le lien est créé, 0 en cas d'erreur
+ *
+ * Les repas encore en cours avec les anciennes listes sont attendus
+ * avant de rendre la main (link_wait()).
+ */
+int	link_add(t_data *data, int a, int b)
+{
+	t_philo		*pa;
+	t_philo		*pb;
+	const int	*old[2];
+	int			nb[2];
+	int			f;
+
+	pa = philo_at(data, a);
+	pb = philo_at(data, b);
+	old[0] = pa->res;
+	nb[0] = pa->nb_res;
+	old[1] = pb->res;
+	nb[1] = pb->nb_res;
+	f = link_fork(data);
+	if (f < 0 || !res_edit(data, pa, f, -1)
+		|| (b != a && !res_edit(data, pb, f, -1)))
+		return (0);
+	link_wait(data, old[0], nb[0]);
+	if (b != a)
+		link_wait(data, old[1], nb[1]);
+	return (1);
+}
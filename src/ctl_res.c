@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ctl_res.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 14:12:50 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/22 14:12:50 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/**
+ * @brief Indique si le philosophe utilise la fourchette f
+ *
+ * Lecture sans verrou : seul le thread de contrôle modifie les listes.
+ */
+int	res_has(t_philo *philo, int f)
+{
+	int	i;
+
+	i = 0;
+	while (i < philo->nb_res)
+		if (philo->res[i++] == f)
+			return (1);
+	return (0);
+}
+
+/**
+ * @brief Publie une nouvelle liste de fourchettes pour un philosophe
+ *
+ * @param data Structure principale
+ * @param philo Philosophe concerné
+ * @param res Nouvelle liste triée, allouée par l'appelant
+ * @param nb Taille de la nouvelle liste
+ *
+ * Le remplacement se fait sous meal_mutex, là où take_forks() photographie
+ * sa liste : le philosophe finit son repas avec l'ancienne et prend la
+ * nouvelle au suivant. L'ancienne peut donc encore être tenue ; elle est
+ * mise de côté (retired) et libérée à la fin de la simulation. Les lignes
+ * de la table CSR initiale ne sont jamais libérées individuellement.
+ */
+static void	res_replace(t_data *data, t_philo *philo, int *res, int nb)
+{
+	t_retired	*node;
+	int			*old;
+	int			own;
+
+	pthread_mutex_lock(&philo->meal_mutex);
+	old = philo->res;
+	own = philo->res_own;
+	philo->res = res;
+	philo->nb_res = nb;
+	philo->res_own = 1;
+	pthread_mutex_unlock(&philo->meal_mutex);
+	if (!own)
+		return ;
+	node = malloc(sizeof(t_retired));
+	if (!node)
+		return ;
+	node->ptr = old;
+	node->next = data->retired;
+	data->retired = node;
+}
+
+/**
+ * @brief Ajoute et/ou retire une fourchette de la liste d'un philosophe
+ *
+ * @param data Structure principale
+ * @param philo Philosophe concerné
+ * @param add Fourchette à ajouter, -1 pour aucune ; doit être plus grande
+ *            que toutes les fourchettes existantes (nouvelle fourchette)
+ * @param del Fourchette à retirer, -1 pour aucune
+ * @return int 1 si la liste a été remplacée, 0 en cas d'erreur d'allocation
+ *
+ * La liste reste triée : l'ordre global d'acquisition est préservé.
+ */
+int	res_edit(t_data *data, t_philo *philo, int add, int del)
+{
+	int	*res;
+	int	nb;
+	int	i;
+
+	res = malloc(sizeof(int) * (philo->nb_res + 1));
+	if (!res)
+		return (0);
+	nb = 0;
+	i = 0;
+	while (i < philo->nb_res)
+	{
+		if (philo->res[i] != del)
+			res[nb++] = philo->res[i];
+		i++;
+	}
+	if (add >= 0)
+		res[nb++] = add;
+	res_replace(data, philo, res, nb);
+	return (1);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ctl_ring.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 10:05:27 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/23 10:05:27 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/**
+ * @brief Remplace, chez P et Q, la fourchette partagée avec x par f
+ *
+ * f est la dernière fourchette créée (ring_leave()). Un seul
+ * res_edit() par voisin : la liste publiée passe de l'ancienne
+ * à la nouvelle en une fois. Si P == Q, il oublie aussi la seconde
+ * fourchette qu'il partageait avec x et garde f comme fourchette propre.
+ */
+static int	ring_drop(t_data *data, t_philo *p, t_philo *q, t_philo *x)
+{
+	int	f;
+
+	f = data->nb_forks - 1;
+	if (!res_edit(data, p, f, link_common(p, x)))
+		return (0);
+	if (q != p)
+		return (res_edit(data, q, f, link_common(q, x)));
+	while (link_common(p, x) >= 0)
+		if (!res_edit(data, p, -1, link_common(p, x)))
+			return (0);
+	return (1);
+}
+
+/**
+ * @brief Insère le philosophe n sur la table ronde, avant ring_head
+ *
+ * @param data Structure principale (table ronde)
+ * @param n Index du nouveau philosophe
+ * @return int 1 si l'insertion réussit, 0 en cas d'erreur
+ *
+ * Entre le dernier L et le premier H : L échange la fourchette L-H
+ * contre L-n, H contre n-H. Tout repas de L ou de H commencé avec
+ * l'ancienne liste tient L-H : les deux nouvelles fourchettes restent
+ * verrouillées jusqu'à ce qu'elle soit rendue. Cas limites couverts :
+ * table d'un (L == H, fourchette propre) et de deux (L et H en
+ * partagent deux).
+ */
+int	ring_join(t_data *data, int n)
+{
+	t_philo	*l;
+	t_philo	*h;
+	int		f[4];
+	int		ok;
+
+	h = philo_at(data, data->ring_head);
+	l = philo_at(data, h->prev);
+	f[2] = link_common(l, h);
+	f[3] = f[2];
+	if (l == h)
+		f[3] = -1;
+	f[0] = link_fork(data);
+	f[1] = link_fork(data);
+	if (f[0] < 0 || f[1] < 0)
+		return (0);
+	pthread_mutex_lock(fork_at(data, f[1]));
+	pthread_mutex_lock(fork_at(data, f[0]));
+	ok = res_edit(data, l, f[0], f[2]) && res_edit(data, h, f[1], f[3])
+		&& res_edit(data, philo_at(data, n), f[0], -1)
+		&& res_edit(data, philo_at(data, n), f[1], -1);
+	link_wait(data, &f[2], 1);
+	pthread_mutex_unlock(fork_at(data, f[1]));
+	pthread_mutex_unlock(fork_at(data, f[0]));
+	if (!ok)
+		return (0);
+	philo_at(data, n)->prev = l->id - 1;
+	philo_at(data, n)->next = data->ring_head;
+	l->next = n;
+	h->prev = n;
+	return (1);
+}
+
+/**
+ * @brief Referme la table ronde après le départ du philosophe x
+ *
+ * @param data Structure principale (table ronde)
+ * @param x Index du philosophe parti (thread joint, ou jamais lancé)
+ * @return int 1 si la table est refermée, 0 en cas d'erreur
+ *
+ * Ses voisins P et Q échangent chacun la fourchette partagée avec x
+ * contre une nouvelle fourchette P-Q, verrouillée jusqu'à ce que les
+ * fourchettes échangées soient rendues : les repas commencés avec les
+ * anciennes listes sont alors finis. S'il ne reste qu'un philosophe
+ * (P == Q), c'est une fourchette propre : il retombe dans le cas du
+ * philosophe seul.
+ */
+int	ring_leave(t_data *data, int x)
+{
+	t_philo	*p;
+	t_philo	*q;
+	int		f[3];
+	int		ok;
+
+	p = philo_at(data, philo_at(data, x)->prev);
+	q = philo_at(data, philo_at(data, x)->next);
+	f[1] = link_common(p, philo_at(data, x));
+	f[2] = link_common(q, philo_at(data, x));
+	f[0] = link_fork(data);
+	if (f[0] < 0)
+		return (0);
+	pthread_mutex_lock(fork_at(data, f[0]));
+	ok = ring_drop(data, p, q, philo_at(data, x));
+	link_wait(data, &f[1], 1);
+	link_wait(data, &f[2], 1);
+	pthread_mutex_unlock(fork_at(data, f[0]));
+	if (!ok)
+		return (0);
+	p->next = q->id - 1;
+	q->prev = p->id - 1;
+	if (data->ring_head == x)
+		data->ring_head = q->id - 1;
+	return (1);
+}
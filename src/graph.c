@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   graph.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 14:07:21 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/18 14:07:21 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+
+/**
+ * @brief Lit entièrement un fichier de graphe
+ *
+ * @param path Chemin du fichier
+ * @return char* Contenu terminé par '\0', NULL en cas d'erreur
+ */
+static char	*graph_read(const char *path)
+{
+	struct stat	st;
+	char		*text;
+	long		len;
+	long		r;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	text = NULL;
+	if (fstat(fd, &st) == 0)
+		text = malloc(st.st_size + 1);
+	len = 0;
+	r = 1;
+	while (text && len < st.st_size && r > 0)
+	{
+		r = read(fd, text + len, st.st_size - len);
+		len += r;
+	}
+	close(fd);
+	if (text && r <= 0)
+	{
+		free(text);
+		return (NULL);
+	}
+	if (text)
+		text[len] = '\0';
+	return (text);
+}
+
+/**
+ * @brief Lit les identifiants de philosophes d'une liste d'arêtes
+ *
+ * @param s Contenu du fichier
+ * @param out Reçoit les identifiants (base 0), NULL pour seulement compter
+ * @param nb_philo Nombre de philosophes (identifiants valides : 1..nb_philo)
+ * @return int Nombre d'identifiants lus, -1 si le fichier est invalide
+ *
+ * Format : une paire "u v" par arête, identifiants comme à l'affichage.
+ * Chaque arête est une ressource (fourchette) partagée par u et v ;
+ * "u u" est une ressource propre à u. '#' commente la fin de ligne.
+ */
+static int	graph_parse(const char *s, int *out, int nb_philo)
+{
+	int		count;
+	long	id;
+
+	count = 0;
+	while (*s)
+	{
+		if (*s == '#')
+			while (*s && *s != '\n')
+				s++;
+		else if (*s >= '0' && *s <= '9')
+		{
+			id = 0;
+			while (*s >= '0' && *s <= '9' && id <= nb_philo)
+				id = id * 10 + (*s++ - '0');
+			if (id < 1 || id > nb_philo)
+				return (-1);
+			if (out)
+				out[count] = id - 1;
+			count++;
+		}
+		else if (*s == ' ' || (*s >= '\t' && *s <= '\r'))
+			s++;
+		else
+			return (-1);
+	}
+	return (count);
+}
+
+/**
+ * @brief Charge la topologie depuis une liste d'arêtes
+ *
+ * @param data Structure principale (nb_philo déjà connu)
+ * @param path Chemin du fichier (variable d'environnement PHILO_GRAPH)
+ * @return int 1 si le graphe est valide et chargé, 0 sinon
+ */
+static int	graph_file(t_data *data, const char *path)
+{
+	char	*text;
+	int		*edges;
+	int		nb;
+	int		ok;
+
+	text = graph_read(path);
+	if (!text)
+		return (0);
+	nb = graph_parse(text, NULL, data->nb_philo);
+	edges = NULL;
+	if (nb > 0 && nb % 2 == 0)
+		edges = malloc(sizeof(int) * nb);
+	ok = 0;
+	if (edges)
+	{
+		graph_parse(text, edges, data->nb_philo);
+		ok = graph_build(data, edges, nb / 2);
+	}
+	free(edges);
+	free(text);
+	return (ok);
+}
+
+/**
+ * @brief Construit la table ronde du sujet
+ *
+ * @param data Structure principale (nb_philo déjà connu)
+ * @return int 1 si la construction réussit, 0 en cas d'erreur d'allocation
+ *
+ * La fourchette j est partagée par les philosophes j-1 et j (base 0) :
+ * le philosophe i utilise donc les fourchettes i et (i+1)%nb_philo.
+ * Avec un seul philosophe, l'unique fourchette est une boucle.
+ */
+static int	graph_ring(t_data *data)
+{
+	int	*edges;
+	int	j;
+	int	ok;
+
+	edges = malloc(sizeof(int) * 2 * data->nb_philo);
+	if (!edges)
+		return (0);
+	j = 0;
+	while (j < data->nb_philo)
+	{
+		edges[2 * j] = (j + data->nb_philo - 1) % data->nb_philo;
+		edges[2 * j + 1] = j;
+		j++;
+	}
+	ok = graph_build(data, edges, data->nb_philo);
+	free(edges);
+	return (ok);
+}
+
+/**
+ * @brief Initialise le graphe des conflits (qui partage quelle fourchette)
+ *
+ * @param data Structure principale (nb_philo déjà connu)
+ * @return int 1 si l'initialisation réussit, 0 en cas d'erreur
+ *
+ * Par défaut : la table ronde. Si PHILO_GRAPH désigne un fichier, la
+ * topologie (grille, arbre, graphe aléatoire...) y est lue ; un
+ * philosophe peut alors avoir besoin de plus de deux fourchettes.
+ */
+int	init_graph(t_data *data)
+{
+	const char	*path;
+
+	path = getenv("PHILO_GRAPH");
+	data->ring = !(path && *path);
+	if (!data->ring)
+		return (graph_file(data, path));
+	return (graph_ring(data));
+}
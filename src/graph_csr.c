@@ -0,0 +1,189 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   graph_csr.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:32:09 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/18 15:32:09 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+#include <string.h>
+
+/**
+ * @brief Calcule les débuts de ligne de la table CSR
+ *
+ * @param data Structure principale, res_off alloué à nb_philo + 1 zéros
+ * @param edges Paires (u, v) en base 0, une par fourchette
+ * @param nb_edges Nombre de fourchettes
+ *
+ * Après l'appel, les fourchettes du philosophe i sont
+ * res_idx[res_off[i]] .. res_idx[res_off[i + 1] - 1].
+ */
+static void	graph_offsets(t_data *data, int *edges, int nb_edges)
+{
+	int	e;
+	int	i;
+
+	e = 0;
+	while (e < nb_edges)
+	{
+		data->res_off[edges[2 * e] + 1]++;
+		if (edges[2 * e + 1] != edges[2 * e])
+			data->res_off[edges[2 * e + 1] + 1]++;
+		e++;
+	}
+	i = 0;
+	while (i < data->nb_philo)
+	{
+		data->res_off[i + 1] += data->res_off[i];
+		i++;
+	}
+}
+
+/**
+ * @brief Remplit les lignes de la table CSR
+ *
+ * @param data Structure principale, res_off calculé
+ * @param edges Paires (u, v) en base 0, une par fourchette
+ * @param nb_edges Nombre de fourchettes
+ * @param pos Curseur d'écriture par philosophe (nb_philo entiers)
+ *
+ * Les fourchettes sont parcourues par index croissant : chaque ligne
+ * est donc déjà triée, sans tri supplémentaire (O(N + E)).
+ */
+static void	graph_fill(t_data *data, int *edges, int nb_edges, int *pos)
+{
+	int	e;
+	int	u;
+	int	v;
+
+	e = 0;
+	while (e < nb_edges)
+	{
+		u = edges[2 * e];
+		v = edges[2 * e + 1];
+		data->res_idx[pos[u]++] = e;
+		if (v != u)
+			data->res_idx[pos[v]++] = e;
+		e++;
+	}
+}
+
+/**
+ * @brief Parcourt en largeur la composante de s et la colore en 0 / 1
+ *
+ * @param data Structure principale, table CSR remplie
+ * @param edges Paires (u, v) en base 0, une par fourchette
+ * @param side Couleur par philosophe, -1 si pas encore visité
+ * @param queue File de parcours (nb_philo entiers), queue[0] = départ
+ * @return int 1 si deux voisins ont la même couleur (cycle impair), 0 sinon
+ *
+ * L'autre extrémité de la fourchette e vue depuis u est
+ * edges[2e] + edges[2e + 1] - u ; une fourchette propre (u u) est ignorée.
+ */
+static int	graph_side(t_data *data, int *edges, int *side, int *queue)
+{
+	int	head;
+	int	tail;
+	int	k;
+	int	u;
+	int	v;
+
+	head = 0;
+	tail = 1;
+	while (head < tail)
+	{
+		u = queue[head++];
+		k = data->res_off[u] - 1;
+		while (++k < data->res_off[u + 1])
+		{
+			v = edges[2 * data->res_idx[k]] + edges[2 * data->res_idx[k] + 1]
+				- u;
+			if (v != u && side[v] < 0)
+			{
+				side[v] = !side[u];
+				queue[tail++] = v;
+			}
+			else if (v != u && side[v] == side[u])
+				return (1);
+		}
+	}
+	return (0);
+}
+
+/**
+ * @brief Indique si le graphe des conflits contient un cycle impair
+ *
+ * @param data Structure principale, table CSR remplie
+ * @param edges Paires (u, v) en base 0, une par fourchette
+ * @param side Tableau de travail (2 * nb_philo entiers)
+ * @return int 1 si le graphe n'est pas biparti, 0 sinon
+ *
+ * Test de bipartition en O(N + E). L'ordre global évite les
+ * interblocages mais pas la famine : sur un cycle impair, un philosophe
+ * peut reprendre ses fourchettes avant son voisin affamé (voir think()).
+ */
+static int	graph_odd(t_data *data, int *edges, int *side)
+{
+	int	*queue;
+	int	s;
+
+	memset(side, -1, sizeof(int) * data->nb_philo);
+	queue = side + data->nb_philo;
+	s = 0;
+	while (s < data->nb_philo)
+	{
+		if (side[s] < 0)
+		{
+			side[s] = 0;
+			queue[0] = s;
+			if (graph_side(data, edges, side, queue))
+				return (1);
+		}
+		s++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Construit la table d'adjacence compacte philosophe -> fourchettes
+ *
+ * @param data Structure principale (nb_philo déjà connu)
+ * @param edges Paires (u, v) en base 0 ; l'arête e est la fourchette e
+ * @param nb_edges Nombre de fourchettes
+ * @return int 1 si la construction réussit, 0 en cas d'erreur d'allocation
+ *
+ * Format CSR : res_off (nb_philo + 1 entiers) et res_idx (une entrée
+ * par extrémité d'arête), chaque ligne triée par index croissant.
+ * take_forks() parcourt sa ligne à l'envers : les fourchettes sont
+ * prises par index décroissant et rendues par index croissant, un ordre
+ * global qui rend l'acquisition sans interblocage quelle que soit la
+ * topologie. Cet ordre n'est pas équitable sur un cycle impair :
+ * odd_cycle le signale à think().
+ */
+int	graph_build(t_data *data, int *edges, int nb_edges)
+{
+	int	*pos;
+
+	data->nb_forks = nb_edges;
+	data->res_off = calloc(data->nb_philo + 1, sizeof(int));
+	if (!data->res_off)
+		return (0);
+	graph_offsets(data, edges, nb_edges);
+	data->res_idx = malloc(sizeof(int) * (data->res_off[data->nb_philo] + 1));
+	pos = malloc(sizeof(int) * data->nb_philo * 2);
+	if (!data->res_idx || !pos)
+	{
+		free(pos);
+		return (0);
+	}
+	memcpy(pos, data->res_off, sizeof(int) * data->nb_philo);
+	graph_fill(data, edges, nb_edges, pos);
+	data->odd_cycle = graph_odd(data, edges, pos);
+	free(pos);
+	return (1);
+}
@@ -11,6 +11,7 @@
 /* ************************************************************************** */
 
 #include "../include/philo.h"
+#include <string.h>
 
 /**
  * @brief Initialise les mutex meal_mutex pour tous les philosophes
@@ -28,7 +29,7 @@ static int	init_philos_meal_mutex(t_data *data)
 	i = 0;
 	while (i < data->nb_philo)
 	{
-		if (pthread_mutex_init(&data->philos[i].meal_mutex, NULL))
+		if (pthread_mutex_init(&philo_at(data, i)->meal_mutex, NULL))
 			return (0);
 		i++;
 	}
@@ -49,13 +50,16 @@ static int	init_philos_meal_mutex(t_data *data)
  *
  * Cette fonction :
  * - Parse et stocke tous les paramètres de simulation
- * - Initialise les flags de contrôle (dead = 0)
+ * - Initialise les flags de contrôle (dead = 0) et les blocs vides
  * - Enregistre le timestamp de début de simulation
  * - Crée les mutex de synchronisation (print_mutex, dead_mutex)
+ * - Construit le graphe des conflits (table ronde ou PHILO_GRAPH)
  * - Appelle les fonctions d'initialisation des fourchettes et philosophes
+ * - Choisit le kernel du scan des échéances (scan_init())
  */
 int	init_data(t_data *data, char **argv)
 {
+	memset(data, 0, sizeof(*data));
 	data->nb_philo = ft_atoi(argv[1]);
 	data->time_to_die = ft_atoi(argv[2]);
 	data->time_to_eat = ft_atoi(argv[3]);
@@ -64,16 +68,16 @@ int	init_data(t_data *data, char **argv)
 		data->nb_meals = ft_atoi(argv[5]);
 	else
 		data->nb_meals = -1;
-	data->dead = 0;
 	data->start_time = get_time();
 	if (pthread_mutex_init(&data->print_mutex, NULL))
 		return (0);
 	if (pthread_mutex_init(&data->dead_mutex, NULL))
 		return (0);
-	if (!init_forks(data))
+	if (!init_graph(data) || !init_forks(data))
 		return (0);
 	if (!init_philos(data))
 		return (0);
+	scan_init(data);
 	return (1);
 }
 
@@ -82,33 +86,21 @@ int	init_data(t_data *data, char **argv)
  *
 
  * @param data Pointeur vers la structure de données contenant le
-	nombre de philosophes
+	nombre de fourchettes (une par arête du graphe des conflits)
  * @return int 1 si l'initialisation réussit,
 	0 en cas d'erreur d'allocation ou de mutex
  *
  * Processus d'initialisation :
- * 1. Alloue dynamiquement un tableau de nb_philo mutex
+ * 1. Alloue les blocs nécessaires pour nb_forks mutex (table_forks())
  * 2. Initialise chaque mutex représentant une fourchette
  * 3. En cas d'échec de pthread_mutex_init, retourne 0
  *
- * Chaque fourchette est partagée entre deux philosophes adjacents :
- * - Fourchette i est utilisée par philosophe i et philosophe (i+1)%nb_philo
+ * Chaque fourchette est partagée par les deux philosophes de son arête :
+ * - Table ronde : fourchette i utilisée par philosophe i et (i+1)%nb_philo
  */
 int	init_forks(t_data *data)
 {
-	int	i;
-
-	data->forks = malloc(sizeof(pthread_mutex_t) * data->nb_philo);
-	if (!data->forks)
-		return (0);
-	i = 0;
-	while (i < data->nb_philo)
-	{
-		if (pthread_mutex_init(&data->forks[i], NULL))
-			return (0);
-		i++;
-	}
-	return (1);
+	return (table_forks(data, 0, data->nb_forks));
 }
 
 /**
@@ -122,33 +114,35 @@ int	init_forks(t_data *data)
  * - meals_eaten : compteur de repas (initialisé à 0)
  * - last_meal_time : timestamp du dernier repas (début de simulation)
  * - data : référence vers les données partagées
- * - left_fork : pointeur vers la fourchette de gauche (mutex i)
- * - right_fork : pointeur vers la fourchette de droite (mutex (i+1)%nb_philo)
+ * - res / nb_res : sa ligne de la table CSR (fourchettes triées)
+ * - prev / next : ses voisins sur la table ronde (canal de contrôle)
  *
- * Attribution des fourchettes :
+ * Attribution des fourchettes (table ronde) :
  * - Philosophe 0 : fourchettes 0 et 1
  * - Philosophe 1 : fourchettes 1 et 2
- * - Philosophe n-1 : fourchettes n-1 et 0 (bouclage)
+ * - Philosophe n-1 : fourchettes 0 et n-1 (bouclage)
  */
 int	init_philos(t_data *data)
 {
-	int	i;
+	t_philo	*philo;
+	int		i;
 
-	data->philos = malloc(sizeof(t_philo) * data->nb_philo);
-	if (!data->philos)
+	if (!table_philos(data, data->nb_philo))
 		return (0);
+	data->nb_active = data->nb_philo;
 	i = 0;
 	while (i < data->nb_philo)
 	{
-		data->philos[i].id = i + 1;
-		data->philos[i].meals_eaten = 0;
-		data->philos[i].eating = 0;
-		data->philos[i].last_meal_time = data->start_time;
-		data->philos[i].data = data;
-		data->philos[i].left_fork = &data->forks[i];
-		data->philos[i].right_fork = &data->forks[(i + 1) % data->nb_philo];
-		if (pthread_mutex_init(&data->philos[i].meal_mutex, NULL))
-			return (0);
+		philo = philo_at(data, i);
+		memset(philo, 0, sizeof(*philo));
+		philo->id = i + 1;
+		philo->last_meal_time = data->start_time;
+		philo->data = data;
+		philo->res = data->res_idx + data->res_off[i];
+		philo->nb_res = data->res_off[i + 1] - data->res_off[i];
+		philo->prev = (i + data->nb_philo - 1) % data->nb_philo;
+		philo->next = (i + 1) % data->nb_philo;
+		scan_publish(philo);
 		i++;
 	}
 	if (!init_philos_meal_mutex(data))
@@ -54,17 +54,50 @@ static int	check_args(int argc, char **argv)
 }
 
 /**
- * @brief Libère toutes les ressources allouées dynamiquement
+ * @brief Libère les blocs de la table et les listes remplacées
+ *
+ * @param data Pointeur vers la structure principale
  *
+ * Les listes de fourchettes remplacées pendant la simulation (join/leave)
+ * ont pu être lues par un philosophe jusqu'à la fin : elles ne sont
+ * libérées qu'ici, une fois tous les threads terminés.
+ */
+static void	cleanup_table(t_data *data)
+{
+	t_retired	*next;
+	int			c;
+
+	c = 0;
+	while (c < CHUNK_MAX)
+	{
+		free(data->forks[c]);
+		free(data->philos[c]);
+		free(data->meal_times[c]);
+		free(data->meal_counts[c]);
+		c++;
+	}
+	while (data->retired)
+	{
+		next = data->retired->next;
+		free(data->retired->ptr);
+		free(data->retired);
+		data->retired = next;
+	}
+}
 
+/**
+ * @brief Libère toutes les ressources allouées dynamiquement
+ *
  * @param data Pointeur vers la structure contenant toutes les données
 	du programme
  *
  * Cette fonction nettoie proprement :
  * - Détruit tous les mutex des fourchettes
- * - Libère la mémoire allouée pour le tableau des fourchettes
+ * - Détruit les mutex des repas et libère les listes propres à un
+ *   philosophe (créées par join/leave)
  * - Détruit les mutex d'affichage et de mort
- * - Libère la mémoire allouée pour le tableau des philosophes
+ * - Libère les blocs de la table, la table CSR du graphe et les
+ *   listes remplacées
  *
  * Doit être appelée avant la fin du programme pour éviter les fuites mémoire
  */
@@ -72,26 +105,20 @@ void	cleanup(t_data *data)
 {
 	int	i;
 
-	if (data->forks)
-	{
-		i = 0;
-		while (i < data->nb_philo)
-		{
-			pthread_mutex_destroy(&data->forks[i]);
-			i++;
-		}
-		free(data->forks);
-	}
-	if (data->philos)
+	i = 0;
+	while (i < data->nb_forks)
+		pthread_mutex_destroy(fork_at(data, i++));
+	i = 0;
+	while (i < data->nb_philo)
 	{
-		i = 0;
-		while (i < data->nb_philo)
-		{
-			pthread_mutex_destroy(&data->philos[i].meal_mutex);
-			i++;
-		}
-		free(data->philos);
+		pthread_mutex_destroy(&philo_at(data, i)->meal_mutex);
+		if (philo_at(data, i)->res_own)
+			free(philo_at(data, i)->res);
+		i++;
 	}
+	free(data->res_off);
+	free(data->res_idx);
+	cleanup_table(data);
 	pthread_mutex_destroy(&data->print_mutex);
 	pthread_mutex_destroy(&data->dead_mutex);
 }
@@ -135,6 +162,7 @@ int	main(int argc, char **argv)
 		cleanup(&data);
 		return (1);
 	}
+	perf_report(&data);
 	cleanup(&data);
 	return (0);
 }
@@ -12,18 +12,48 @@
 
 #include "../include/philo.h"
 
+/**
+ * @brief Confirme sous meal_mutex un candidat signalé par le scan
+ *
+ * @param data Structure principale
+ * @param i Index du philosophe candidat
+ * @param now Timestamp absolu utilisé pour le scan
+ * @return int 1 si le philosophe est réellement mort, 0 sinon
+ *
+ * Les tableaux du scan peuvent retarder d'un repas sur last_meal_time :
+ * un faux positif coûte un tour de monitor, jamais une fausse mort.
+ * Un philosophe retiré par le canal de contrôle ne meurt plus.
+ */
+static int	confirm_death(t_data *data, int i, long long now)
+{
+	t_philo		*philo;
+	long long	last_meal;
+	int			leaving;
+
+	philo = philo_at(data, i);
+	pthread_mutex_lock(&philo->meal_mutex);
+	last_meal = philo->last_meal_time;
+	leaving = philo->leaving;
+	pthread_mutex_unlock(&philo->meal_mutex);
+	return (!leaving && now - last_meal >= data->time_to_die);
+}
+
 /**
  * @brief Vérifie si un philosophe est mort de faim
  *
 
 	* @param data Pointeur vers la structure contenant tous les
 	philosophes et paramètres
+ * @param hungry Reçoit le nombre de philosophes présents n'ayant pas
+ *               encore atteint nb_meals
  * @return int 1 si un philosophe est mort, 0 si tous sont encore vivants
  *
  * Processus de vérification :
- * 1. Parcourt tous les philosophes séquentiellement
- * 2. Pour chaque philosophe, calcule le temps écoulé depuis son dernier repas
- * 3. Si ce temps dépasse time_to_die, le philosophe meurt :
+ * 1. Lit l'heure une seule fois pour tout le tour
+ * 2. Scanne en un passage les copies contiguës meal_times/meal_counts,
+ *    bloc par bloc (kernel SIMD choisi par scan_init()) : premier expiré
+ *    et repas finis
+ * 3. Confirme le candidat sous son meal_mutex, puis :
  *    - Active le flag global 'dead' (protégé par mutex)
  *    - Affiche le message de mort avec timestamp
  *    - Retourne 1 pour arrêter la simulation
@@ -34,45 +64,48 @@
  *
  * Note : Cette fonction est appelée en continu par le thread principal
  */
-int	check_death(t_data *data)
+int	check_death(t_data *data, int *hungry)
 {
-	int			i;
+	t_scan		scan;
 	long long	current_time;
-	long long	last_meal;
+	int			active;
+	int			i;
 
-	i = 0;
-	while (i < data->nb_philo)
-	{
-		current_time = get_time();
-		pthread_mutex_lock(&data->philos[i].meal_mutex);
-		last_meal = data->philos[i].last_meal_time;
-		pthread_mutex_unlock(&data->philos[i].meal_mutex);
-		if (current_time - last_meal >= data->time_to_die)
-		{
-			pthread_mutex_lock(&data->dead_mutex);
-			data->dead = 1;
-			pthread_mutex_unlock(&data->dead_mutex);
-			pthread_mutex_lock(&data->print_mutex);
-			printf("%lld %d died\n", current_time - data->start_time,
-				data->philos[i].id);
-			pthread_mutex_unlock(&data->print_mutex);
-			return (1);
-		}
-		i++;
-	}
-	return (0);
+	active = __atomic_load_n(&data->nb_active, __ATOMIC_ACQUIRE);
+	current_time = get_time();
+	scan.limit = current_time - data->start_time - data->time_to_die + 1;
+	scan.goal = INT_MAX;
+	if (data->nb_meals != -1)
+		scan.goal = data->nb_meals - 1;
+	scan.finished = 0;
+	i = scan_all(data, &scan);
+	*hungry = active - scan.finished;
+	if (i < 0 || !confirm_death(data, i, current_time))
+		return (0);
+	pthread_mutex_lock(&data->dead_mutex);
+	data->dead = 1;
+	pthread_mutex_unlock(&data->dead_mutex);
+	pthread_mutex_lock(&data->print_mutex);
+	printf("%lld %d died\n", current_time - data->start_time,
+		philo_at(data, i)->id);
+	pthread_mutex_unlock(&data->print_mutex);
+	return (1);
 }
 
 /**
  * @brief Vérifie si tous les philosophes ont terminé de manger
  *
  * @param data Pointeur vers la structure contenant les philosophes et nb_meals
+ * @param hungry Philosophes présents pas encore rassasiés (check_death())
  * @return int 1 si tous ont fini leurs repas, 0 sinon
  *
  * Logique de vérification :
  * 1. Si nb_meals == -1 (simulation infinie), retourne toujours 0
- * 2. Compte le nombre de philosophes ayant atteint leur quota de repas
- * 3. Si tous les philosophes ont mangé nb_meals fois ou plus :
+ * 2. Le comptage a déjà été fait pendant le scan des échéances ;
+ *    nb_active est lu avant le scan : un départ ou une arrivée pendant
+ *    le tour ne peut pas terminer la simulation à tort
+ * 3. Si tous les philosophes présents (nb_active) ont mangé nb_meals
+ *    fois ou plus :
  *    - Active le flag 'dead' pour arrêter la simulation
  *    - Retourne 1 pour signaler la fin de la simulation
  *
@@ -83,28 +116,12 @@ int	check_death(t_data *data)
  *
  * Thread-safety :
  * - Utilise dead_mutex pour protéger l'accès au flag 'dead'
- * - Lecture thread-safe de meals_eaten (entier atomique)
  */
-int	check_meals(t_data *data)
+int	check_meals(t_data *data, int hungry)
 {
-	int	i;
-	int	finished;
-	int	current_meals;
-
 	if (data->nb_meals == -1)
 		return (0);
-	finished = 0;
-	i = 0;
-	while (i < data->nb_philo)
-	{
-		pthread_mutex_lock(&data->philos[i].meal_mutex);
-		current_meals = data->philos[i].meals_eaten;
-		pthread_mutex_unlock(&data->philos[i].meal_mutex);
-		if (current_meals >= data->nb_meals)
-			finished++;
-		i++;
-	}
-	if (finished == data->nb_philo)
+	if (hungry <= 0)
 	{
 		pthread_mutex_lock(&data->dead_mutex);
 		data->dead = 1;
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:12:04 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/15 10:12:04 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+#ifdef PHILO_PERF
+
+# include <linux/perf_event.h>
+# include <string.h>
+# include <sys/syscall.h>
+
+/**
+ * @brief Ouvre un compteur perf_event pour le thread appelant
+ *
+ * @param type Type d'évènement (PERF_TYPE_HARDWARE ou PERF_TYPE_SOFTWARE)
+ * @param config Évènement à compter dans ce type
+ * @param group_fd Leader du groupe, -1 pour créer un nouveau groupe
+ * @return int Descripteur du compteur, -1 si indisponible
+ *
+ * pid = 0 et cpu = -1 : seul le thread appelant est compté, sur tous
+ * les CPU. Le noyau est exclu des évènements matériels pour rester
+ * lisible avec perf_event_paranoid = 2 (cas courant hors root) ; les
+ * évènements logiciels (context-switches) n'existent que côté noyau.
+ */
+static int	perf_event(unsigned int type, unsigned long long config,
+		int group_fd)
+{
+	struct perf_event_attr	attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.read_format = PERF_FORMAT_GROUP;
+	attr.exclude_kernel = (type == PERF_TYPE_HARDWARE);
+	attr.exclude_hv = 1;
+	return (syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+/**
+ * @brief Ferme tous les compteurs ouverts du thread
+ *
+ * @param perf Contexte d'instrumentation du thread appelant
+ */
+static void	perf_close_fds(t_perf *perf)
+{
+	while (perf->nb_fd > 0)
+	{
+		perf->nb_fd--;
+		close(perf->fd[perf->nb_fd]);
+	}
+}
+
+/**
+ * @brief Ajoute un compteur au groupe, ferme tout le groupe en cas d'échec
+ *
+ * @param perf Contexte d'instrumentation du thread appelant
+ * @param type Type d'évènement perf
+ * @param config Évènement à compter
+ * @return int 1 si le compteur a été ajouté, 0 sinon (groupe fermé)
+ *
+ * Le premier compteur ouvert devient le leader du groupe (fd[0]).
+ */
+static int	perf_add(t_perf *perf, unsigned int type, unsigned long long config)
+{
+	int	fd;
+	int	leader;
+
+	leader = -1;
+	if (perf->nb_fd > 0)
+		leader = perf->fd[0];
+	fd = perf_event(type, config, leader);
+	if (fd < 0)
+	{
+		perf_close_fds(perf);
+		return (0);
+	}
+	perf->fd[perf->nb_fd++] = fd;
+	return (1);
+}
+
+/**
+ * @brief Ouvre le groupe de compteurs le plus riche disponible
+ *
+ * @param perf Contexte d'instrumentation du thread appelant
+ *
+ * Niveaux de repli :
+ * - 2 : matériel (cycles, instructions, cache-misses) + context-switches
+ * - 1 : logiciel perf (task-clock en ns) + context-switches
+ * - 0 : getrusage(RUSAGE_THREAD), toujours disponible (VM, conteneurs)
+ *
+ * Les membres du groupe sont lus en un seul read() sur le leader
+ * (PERF_FORMAT_GROUP) : un changement de phase coûte un appel système.
+ * Le premier échantillon sert de référence et n'est attribué à aucune phase.
+ */
+void	perf_open(t_perf *perf)
+{
+	memset(perf, 0, sizeof(*perf));
+	perf->level = 2;
+	if (!perf_add(perf, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES)
+		|| !perf_add(perf, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS)
+		|| !perf_add(perf, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES)
+		|| !perf_add(perf, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES))
+	{
+		perf->level = 1;
+		if (!perf_add(perf, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK)
+			|| !perf_add(perf, PERF_TYPE_SOFTWARE,
+				PERF_COUNT_SW_CONTEXT_SWITCHES))
+			perf->level = 0;
+	}
+	perf_enter(perf, PH_OTHER);
+	memset(perf->acc, 0, sizeof(perf->acc));
+}
+
+/**
+ * @brief Attribue les derniers compteurs à la phase courante et ferme
+ *
+ * @param perf Contexte d'instrumentation du thread appelant
+ *
+ * Doit être appelée par le thread lui-même avant de se terminer,
+ * les compteurs ne mesurant que le thread qui les a ouverts.
+ */
+void	perf_close(t_perf *perf)
+{
+	perf_enter(perf, PH_OTHER);
+	perf_close_fds(perf);
+}
+
+#else
+
+void	perf_open(t_perf *perf)
+{
+	(void)perf;
+}
+
+void	perf_close(t_perf *perf)
+{
+	(void)perf;
+}
+
+#endif
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf_read.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:40:17 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/15 10:40:17 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../include/philo.h"
+
+#ifdef PHILO_PERF
+
+# include <sys/resource.h>
+# include <time.h>
+
+/**
+ * @brief Compteurs logiciels de dernier recours (niveau 0)
+ *
+ * @param vals Tableau de compteurs à remplir
+ *
+ * Temps CPU du thread (utilisateur + système) en nanosecondes à la place
+ * des cycles, et changements de contexte volontaires + involontaires.
+ * Instructions et cache-misses restent à 0.
+ */
+static void	perf_rusage(long long *vals)
+{
+	struct rusage	ru;
+
+	getrusage(RUSAGE_THREAD, &ru);
+	vals[0] = (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000000LL
+		+ (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1000LL;
+	vals[3] = ru.ru_nvcsw + ru.ru_nivcsw;
+}
+
+/**
+ * @brief Lit l'état courant de tous les compteurs du thread
+ *
+ * @param perf Contexte d'instrumentation du thread appelant
+ * @param vals Tableau de PERF_NB_VAL compteurs à remplir
+ *
+ * Le read() sur le leader renvoie { nr, valeur[0], ..., valeur[nr-1] }
+ * dans l'ordre d'ouverture du groupe (voir perf_open()). Si la lecture
+ * échoue, les compteurs gardent leur dernière valeur : rien n'est
+ * attribué, et les unités du niveau du thread ne sont jamais mélangées.
+ */
+static void	perf_sample(t_perf *perf, long long *vals)
+{
+	unsigned long long	buf[PERF_NB_FD + 1];
+	struct timespec		ts;
+	int					i;
+
+	i = 0;
+	while (i < PERF_NB_VAL)
+	{
+		vals[i] = perf->last[i];
+		i++;
+	}
+	if (perf->level == 0)
+		perf_rusage(vals);
+	else if (read(perf->fd[0], buf, sizeof(buf)) >= (long)(3 * sizeof(*buf)))
+	{
+		vals[0] = buf[1];
+		vals[3] = buf[2];
+		if (perf->level == 2)
+		{
+			vals[1] = buf[2];
+			vals[2] = buf[3];
+			vals[3] = buf[4];
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	vals[4] = ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * @brief Change la phase courante du thread
+ *
+ * @param perf Contexte d'instrumentation du thread appelant
+ * @param phase Nouvelle phase
+ * @return t_phase Phase précédente, pour la restaurer après une sous-phase
+ *
+ * Tout ce qui a été compté depuis le dernier changement est attribué à
+ * la phase qui se termine. Les phases sont donc exclusives : le temps
+ * passé dans print_status() pendant take_forks() compte comme PH_LOG,
+ * pas comme PH_FORKS.
+ */
+t_phase	perf_enter(t_perf *perf, t_phase phase)
+{
+	long long	vals[PERF_NB_VAL];
+	t_phase		prev;
+	int			i;
+
+	perf_sample(perf, vals);
+	i = 0;
+	while (i < PERF_NB_VAL)
+	{
+		perf->acc[perf->phase][i] += vals[i] - perf->last[i];
+		perf->last[i] = vals[i];
+		i++;
+	}
+	prev = perf->phase;
+	perf->phase = phase;
+	return (prev);
+}
+
+#else
+
+t_phase	perf_enter(t_perf *perf, t_phase phase)
+{
+	(void)perf;
+	(void)phase;
+	return (PH_OTHER);
+}
+
+#endif
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf_report.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 11:05:52 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/15 11:05:52 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+#ifdef PHILO_PERF
+
+# include <string.h>
+
+/**
+ * @brief Ajoute les compteurs d'un thread au total de son niveau
+ *
+ * @param total Totaux par niveau puis par phase
+ * @param count Nombre de threads par niveau (mis à jour)
+ * @param perf Contexte d'instrumentation d'un thread terminé
+ *
+ * v[0] n'a pas la même unité selon le niveau (cycles en matériel,
+ * nanosecondes sinon) : les niveaux ne sont jamais additionnés.
+ */
+static void	perf_sum(long long total[3][PH_COUNT][PERF_NB_VAL], int *count,
+		t_perf *perf)
+{
+	int	phase;
+	int	i;
+
+	count[perf->level]++;
+	phase = 0;
+	while (phase < PH_COUNT)
+	{
+		i = 0;
+		while (i < PERF_NB_VAL)
+		{
+			total[perf->level][phase][i] += perf->acc[phase][i];
+			i++;
+		}
+		phase++;
+	}
+}
+
+/**
+ * @brief Affiche une ligne du résumé sur stderr
+ *
+ * @param level Niveau de compteurs des threads additionnés
+ * @param phase Phase à afficher
+ * @param v Totaux de la phase
+ *
+ * En niveau matériel : cycles, instructions, IPC et cache-misses.
+ * Sinon la colonne CPU est le temps CPU du thread en millisecondes.
+ */
+static void	perf_print_phase(int level, t_phase phase, long long *v)
+{
+	const char	*names[PH_COUNT] = {"other", "forks", "eat", "dream", "log",
+		"monitor"};
+	double		ipc;
+
+	if (level == 2)
+	{
+		ipc = 0;
+		if (v[0])
+			ipc = (double)v[1] / v[0];
+		fprintf(stderr, "%-8s %12.3f %14lld %14lld %6.2f %12lld %10lld\n",
+			names[phase], v[4] / 1e6, v[0], v[1], ipc, v[2], v[3]);
+	}
+	else
+		fprintf(stderr, "%-8s %12.3f %14.3f %10lld\n", names[phase],
+			v[4] / 1e6, v[0] / 1e6, v[3]);
+}
+
+/**
+ * @brief Affiche le tableau des threads d'un même niveau
+ *
+ * @param total Totaux par phase des threads de ce niveau
+ * @param level Niveau de compteurs
+ * @param count Nombre de threads de ce niveau
+ */
+static void	perf_print_level(long long total[PH_COUNT][PERF_NB_VAL], int level,
+		int count)
+{
+	int	i;
+
+	fprintf(stderr, "perf: %d threads, %s counters\n", count,
+		(const char *[]){"rusage", "software", "hardware"}[level]);
+	if (level == 2)
+		fprintf(stderr, "%-8s %12s %14s %14s %6s %12s %10s\n", "phase",
+			"wall_ms", "cycles", "instructions", "ipc", "cache_miss",
+			"ctx_sw");
+	else
+		fprintf(stderr, "%-8s %12s %14s %10s\n", "phase", "wall_ms",
+			"cpu_ms", "ctx_sw");
+	i = 0;
+	while (i < PH_COUNT)
+	{
+		perf_print_phase(level, i, total[i]);
+		i++;
+	}
+}
+
+/**
+ * @brief Résume les compteurs de tous les threads à la fin de la simulation
+ *
+ * @param data Données de la simulation, tous les threads étant joints
+ *
+ * Additionne les philosophes et le monitor phase par phase, un tableau
+ * par niveau de compteurs obtenu : au-delà de ~250 philosophes, les
+ * descripteurs perf manquent (4 par thread) et les derniers threads
+ * passent en logiciel. Le résumé part sur stderr pour ne pas polluer la
+ * sortie de simulation.
+ */
+void	perf_report(t_data *data)
+{
+	long long	total[3][PH_COUNT][PERF_NB_VAL];
+	int			count[3];
+	int			level;
+	int			i;
+
+	memset(total, 0, sizeof(total));
+	memset(count, 0, sizeof(count));
+	i = 0;
+	while (i < data->nb_philo)
+		perf_sum(total, count, &philo_at(data, i++)->perf);
+	perf_sum(total, count, &data->perf);
+	level = 3;
+	while (level-- > 0)
+		if (count[level])
+			perf_print_level(total[level], level, count[level]);
+}
+
+#else
+
+void	perf_report(t_data *data)
+{
+	(void)data;
+}
+
+#endif
@@ -12,71 +12,181 @@
 
 #include "../include/philo.h"
 
+/**
+ * @brief Rend les fourchettes photographiées, par index croissant
+ */
+static void	forks_drop(t_philo *philo)
+{
+	int	i;
+
+	i = 0;
+	while (i < philo->nb_held)
+		pthread_mutex_unlock(fork_at(philo->data, philo->held[i++]));
+}
+
+/**
+ * @brief Verrouille la liste photographiée et vérifie qu'elle est à jour
+ *
+ * @param philo Philosophe dont held vient d'être photographiée
+ * @return int 1 si toutes les fourchettes sont tenues et que la liste n'a
+ *             pas changé, 0 si elle a changé (fourchettes rendues)
+ *
+ * Un philosophe bloqué sur une fourchette pendant un join ou un leave
+ * a photographié l'ancienne liste : manger avec elle casserait
+ * l'exclusion avec le nouveau voisin. La vérification se fait sous
+ * meal_mutex, là où res_edit() publie les nouvelles listes.
+ */
+static int	forks_grab(t_philo *philo)
+{
+	int	same;
+	int	i;
+
+	i = philo->nb_held;
+	while (i-- > 0)
+		pthread_mutex_lock(fork_at(philo->data, philo->held[i]));
+	pthread_mutex_lock(&philo->meal_mutex);
+	same = (philo->res == philo->held);
+	pthread_mutex_unlock(&philo->meal_mutex);
+	if (!same)
+		forks_drop(philo);
+	return (same);
+}
+
 /**
  * @brief Gère l'acquisition des fourchettes par un philosophe
  *
  * @param philo Pointeur vers le philosophe qui veut prendre les fourchettes
+ * @return int 1 si toutes les fourchettes sont prises, 0 sinon
  *
  * Stratégie anti-deadlock :
- * - Philosophes PAIRS (id
-	% 2 == 0) : prennent d'abord la fourchette DROITE puis GAUCHE
- * - Philosophes IMPAIRS (id
-	% 2 == 1) : prennent d'abord la fourchette GAUCHE puis DROITE
+ * - Chaque philosophe prend ses fourchettes (res, nb_res, triées par la
+ *   table CSR) par index global décroissant ; eat() les rend ensuite par
+ *   index croissant
  *
- * Cette différenciation d'ordre évite les interblocages (deadlocks) car :
- * - Tous les philosophes ne peuvent pas prendre la même première fourchette
- * - Au moins un philosophe peut toujours progresser dans le cycle
+ * Cet ordre global évite les interblocages (deadlocks) car :
+ * - Un philosophe n'attend jamais qu'une fourchette d'index plus petit
+ *   que toutes celles qu'il tient déjà
+ * - Dans un cycle d'attente, chaque philosophe attendrait une fourchette
+ *   tenue par le suivant, d'index plus petit : les index décroîtraient
+ *   strictement tout autour du cycle, ce qui est impossible
+ * - Valable pour toute topologie, pas seulement la table ronde
  *
  * Actions effectuées :
- * 1. Verrouille le premier mutex selon la stratégie
- * 2. Affiche "has taken a fork"
- * 3. Verrouille le second mutex
- * 4. Affiche "has taken a fork" à nouveau
+ * 1. Photographie sa liste (held) sous meal_mutex
+ * 2. Verrouille toutes ses fourchettes ; si le canal de contrôle a
+ *    remplacé la liste entre-temps, les rend et recommence (forks_grab())
+ * 3. Affiche "has taken a fork" pour chaque fourchette tenue
+ *
+ * Cas du philosophe seul à table : il prend l'unique fourchette et meurt
+ * de faim.
  *
  * Note : Cette fonction ne libère PAS les fourchettes (fait dans eat())
  */
 static int	take_forks(t_philo *philo)
 {
-	pthread_mutex_lock(philo->right_fork);
-	print_status(philo, "has taken a fork");
-	if (philo->data->nb_philo == 1)
+	int	ok;
+	int	i;
+
+	perf_enter(&philo->perf, PH_FORKS);
+	ok = 0;
+	while (!ok)
 	{
-		ft_usleep(philo->data->time_to_die);
-		pthread_mutex_unlock(philo->right_fork);
-		return (0);
+		pthread_mutex_lock(&philo->meal_mutex);
+		philo->held = philo->res;
+		philo->nb_held = philo->nb_res;
+		pthread_mutex_unlock(&philo->meal_mutex);
+		if (philo->data->ring && philo->nb_held > 0
+			&& __atomic_load_n(&philo->data->nb_active, __ATOMIC_ACQUIRE) == 1)
+		{
+			pthread_mutex_lock(fork_at(philo->data, philo->held[0]));
+			print_status(philo, "has taken a fork");
+			ft_usleep(philo->data->time_to_die);
+			pthread_mutex_unlock(fork_at(philo->data, philo->held[0]));
+			return (0);
+		}
+		ok = forks_grab(philo);
 	}
-	pthread_mutex_lock(philo->left_fork);
-	print_status(philo, "has taken a fork");
+	i = philo->nb_held;
+	while (i-- > 0)
+		print_status(philo, "has taken a fork");
 	return (1);
 }
 
+/**
+ * @brief Mange puis libère les fourchettes dans l'ordre inverse
+ *
+ * @param philo Philosophe qui tient toutes ses fourchettes
+ */
 static void	eat(t_philo *philo)
 {
+	perf_enter(&philo->perf, PH_EAT);
 	philo->eating = 1;
 	print_status(philo, "is eating");
 	pthread_mutex_lock(&philo->meal_mutex);
 	philo->last_meal_time = get_time();
 	philo->meals_eaten++;
+	scan_publish(philo);
 	pthread_mutex_unlock(&philo->meal_mutex);
 	ft_usleep(philo->data->time_to_eat);
 	philo->eating = 0;
-	pthread_mutex_unlock(philo->left_fork);
-	pthread_mutex_unlock(philo->right_fork);
+	forks_drop(philo);
 }
 
 static void	dream(t_philo *philo)
 {
+	perf_enter(&philo->perf, PH_DREAM);
 	print_status(philo, "is sleeping");
 	ft_usleep(philo->data->time_to_sleep);
 }
 
+/**
+ * @brief Pense, avec un délai d'équité si les conflits forment un cycle
+ * impair
+ *
+ * @param philo Philosophe qui vient de dormir
+ *
+ * L'ordre global d'acquisition évite les interblocages, pas la famine :
+ * sur un cycle impair (table ronde impaire ou graphe non biparti), un
+ * philosophe peut reprendre ses fourchettes avant son voisin affamé.
+ * Attendre la moitié de (2 * time_to_eat - time_to_sleep) laisse passer
+ * le voisin sans consommer la marge avant time_to_die. La table ronde
+ * suit le nombre de présents ; un graphe suit odd_cycle (graph_build(),
+ * ctl_join()).
+ */
 static void	think(t_philo *philo)
 {
+	int	odd;
+	int	delay;
+
+	perf_enter(&philo->perf, PH_OTHER);
 	print_status(philo, "is thinking");
+	if (philo->data->ring)
+		odd = __atomic_load_n(&philo->data->nb_active, __ATOMIC_ACQUIRE) % 2;
+	else
+		odd = __atomic_load_n(&philo->data->odd_cycle, __ATOMIC_RELAXED);
+	if (!odd)
+		return ;
+	delay = 2 * philo->data->time_to_eat - philo->data->time_to_sleep;
+	if (delay > 0)
+		ft_usleep(delay / 2);
 }
 
+/**
+ * @brief Indique si le philosophe doit s'arrêter
+ *
+ * @param philo Philosophe en début de cycle (aucune fourchette tenue)
+ * @return int 1 si la simulation est finie ou si le canal de contrôle
+ *             l'a retiré de la table, 0 sinon
+ */
 static int	dead_loop(t_philo *philo)
 {
+	int	leaving;
+
+	pthread_mutex_lock(&philo->meal_mutex);
+	leaving = philo->leaving;
+	pthread_mutex_unlock(&philo->meal_mutex);
+	if (leaving)
+		return (1);
 	pthread_mutex_lock(&philo->data->dead_mutex);
 	if (philo->data->dead == 1)
 	{
@@ -92,6 +202,7 @@ void	*philo_routine(void *arg)
 	t_philo	*philo;
 
 	philo = (t_philo *)arg;
+	perf_open(&philo->perf);
 	if (philo->id % 2 == 0)
 		ft_usleep(1);
 	while (!dead_loop(philo))
@@ -102,34 +213,54 @@ void	*philo_routine(void *arg)
 		dream(philo);
 		think(philo);
 	}
+	perf_close(&philo->perf);
 	return (NULL);
 }
 
 static void	*monitor(void *pointer)
 {
 	t_data	*data;
+	int		hungry;
 
 	data = (t_data *)pointer;
+	perf_open(&data->perf);
+	perf_enter(&data->perf, PH_MONITOR);
 	while (1)
-		if (check_death(data) == 1 || check_meals(data) == 1)
+		if (check_death(data, &hungry) == 1
+			|| check_meals(data, hungry) == 1)
 			break ;
+	perf_close(&data->perf);
 	return (NULL);
 }
 
 void	start_simulation2(t_data *data)
 {
-	int	i;
+	t_philo	*philo;
+	int		i;
 
 	i = 0;
 	while (i < data->nb_philo)
 	{
-		pthread_mutex_lock(&data->philos[i].meal_mutex);
-		data->philos[i].last_meal_time = data->start_time;
-		pthread_mutex_unlock(&data->philos[i].meal_mutex);
+		philo = philo_at(data, i);
+		pthread_mutex_lock(&philo->meal_mutex);
+		philo->last_meal_time = data->start_time;
+		scan_publish(philo);
+		pthread_mutex_unlock(&philo->meal_mutex);
 		i++;
 	}
 }
 
+/**
+ * @brief Lance le monitor, les philosophes et le canal de contrôle
+ *
+ * @param data Structure principale initialisée
+ * @return int 1 si la simulation s'est déroulée, 0 si un thread n'a pu
+ *             être créé
+ *
+ * Le canal de contrôle démarre après les philosophes initiaux et
+ * s'arrête avant la jointure finale : nb_philo ne bouge plus quand on
+ * joint les philosophes restants (ceux partis sont déjà joints).
+ */
 int	start_simulation(t_data *data)
 {
 	pthread_t	observer;
@@ -142,16 +273,19 @@ int	start_simulation(t_data *data)
 	i = 0;
 	while (i < data->nb_philo)
 	{
-		if (pthread_create(&data->philos[i].thread, NULL, philo_routine,
-				&data->philos[i]) != 0)
+		if (pthread_create(&philo_at(data, i)->thread, NULL, philo_routine,
+				philo_at(data, i)) != 0)
 			return (0);
 		i++;
 	}
+	ctl_start(data);
 	pthread_join(observer, NULL);
+	ctl_stop(data);
 	i = 0;
 	while (i < data->nb_philo)
 	{
-		pthread_join(data->philos[i].thread, NULL);
+		if (!philo_at(data, i)->gone)
+			pthread_join(philo_at(data, i)->thread, NULL);
 		i++;
 	}
 	return (1);
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scan.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 09:21:33 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/16 09:21:33 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/**
+ * @brief Scan de référence, un philosophe à la fois
+ *
+ * @param scan Tableaux à parcourir, seuils et compteur de repas
+ * @return int Index du premier philosophe expiré, -1 si aucun
+ *
+ * Compte dans scan->finished les philosophes ayant atteint nb_meals.
+ * S'arrête au premier expiré : le compte est alors partiel, mais la
+ * mort est prioritaire sur la fin des repas.
+ *
+ * Les lectures sont atomiques (relaxed) : les philosophes publient
+ * sans passer par le mutex du monitor (voir scan_publish()). Ce kernel
+ * est aussi celui des builds ThreadSanitizer, qui ne comprend pas
+ * les chargements vectoriels.
+ */
+int	scan_scalar(t_scan *scan)
+{
+	int	i;
+
+	i = 0;
+	while (i < scan->n)
+	{
+		if (__atomic_load_n(&scan->times[i], __ATOMIC_RELAXED) < scan->limit)
+			return (i);
+		if (__atomic_load_n(&scan->meals[i], __ATOMIC_RELAXED) > scan->goal)
+			scan->finished++;
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Choisit le kernel de scan le plus large supporté par le CPU
+ *
+ * @return t_scan_fn Kernel AVX-512, AVX2, SSE2 (base x86-64) ou scalaire
+ *
+ * La détection est faite une seule fois à l'initialisation, le binaire
+ * reste exécutable sur n'importe quel x86-64.
+ */
+static t_scan_fn	scan_select(void)
+{
+#if defined(__x86_64__) && !defined(__SANITIZE_THREAD__)
+
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		return (&scan_avx512);
+	if (__builtin_cpu_supports("avx2"))
+		return (&scan_avx2);
+	return (&scan_sse2);
+#else
+
+	return (&scan_scalar);
+#endif
+}
+
+/**
+ * @brief Choisit le kernel du scan des échéances
+ *
+ * @param data Structure principale
+ *
+ * Les tableaux eux-mêmes sont alloués par blocs de CHUNK_SIZE cases
+ * (table_philos()), alignés sur SCAN_ALIGN, CHUNK_SIZE étant un
+ * multiple de SCAN_PAD : les kernels n'ont pas de boucle de fin. Les
+ * cases non publiées ne sont jamais expirées (INT_MAX) ni rassasiées
+ * (INT_MIN).
+ */
+void	scan_init(t_data *data)
+{
+	data->scan = scan_select();
+}
+
+/**
+ * @brief Scanne tous les blocs de philosophes publiés
+ *
+ * @param data Structure principale
+ * @param scan limit et goal remplis par l'appelant, finished à 0
+ * @return int Index global du premier philosophe expiré, -1 si aucun
+ *
+ * nb_philo est lu avec acquire : les blocs et cases d'un philosophe
+ * ajouté par le canal de contrôle sont visibles avant lui. Le dernier
+ * bloc n'est scanné que jusqu'au multiple de SCAN_PAD suivant.
+ */
+int	scan_all(t_data *data, t_scan *scan)
+{
+	int	nb;
+	int	c;
+	int	i;
+
+	nb = __atomic_load_n(&data->nb_philo, __ATOMIC_ACQUIRE);
+	c = 0;
+	while (c * CHUNK_SIZE < nb)
+	{
+		scan->times = data->meal_times[c];
+		scan->meals = data->meal_counts[c];
+		scan->n = nb - c * CHUNK_SIZE;
+		if (scan->n > CHUNK_SIZE)
+			scan->n = CHUNK_SIZE;
+		scan->n = (scan->n + SCAN_PAD - 1) / SCAN_PAD * SCAN_PAD;
+		i = data->scan(scan);
+		if (i >= 0)
+			return (c * CHUNK_SIZE + i);
+		c++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Recopie l'état d'un philosophe dans les tableaux du monitor
+ *
+ * @param philo Philosophe dont meal_mutex est tenu par l'appelant
+ *
+ * Le temps est stocké en ms relatives à start_time sur 32 bits
+ * (24 jours de simulation), ce qui permet des comparaisons SSE2.
+ * Ces copies ne servent qu'à repérer un candidat : check_death()
+ * confirme toujours sous meal_mutex avec last_meal_time.
+ * Un philosophe parti (leaving) est remis à l'état neutre.
+ */
+void	scan_publish(t_philo *philo)
+{
+	int	*time;
+	int	*meals;
+	int	i;
+
+	i = philo->id - 1;
+	time = &philo->data->meal_times[i / CHUNK_SIZE][i % CHUNK_SIZE];
+	meals = &philo->data->meal_counts[i / CHUNK_SIZE][i % CHUNK_SIZE];
+	if (philo->leaving)
+	{
+		__atomic_store_n(time, INT_MAX, __ATOMIC_RELAXED);
+		__atomic_store_n(meals, INT_MIN, __ATOMIC_RELAXED);
+		return ;
+	}
+	__atomic_store_n(time, (int)(philo->last_meal_time
+			- philo->data->start_time), __ATOMIC_RELAXED);
+	__atomic_store_n(meals, philo->meals_eaten, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scan_x86.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:02:48 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/16 10:02:48 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+#if defined(__x86_64__)
+
+# include <immintrin.h>
+
+/*
+ * Kernels vectoriels du scan des échéances (voir scan_scalar() pour la
+ * sémantique). Chaque kernel est compilé pour son jeu d'instructions via
+ * l'attribut target, sans drapeau global : scan_select() ne les appelle
+ * que si le CPU les supporte. Les tableaux sont alignés sur SCAN_ALIGN
+ * et scan->n est un multiple de SCAN_PAD, d'où les chargements alignés
+ * sans boucle de fin.
+ *
+ * Comptage des repas : une comparaison vraie vaut -1 par voie, la
+ * soustraire de l'accumulateur ajoute 1.
+ */
+
+static int	scan_hsum128(__m128i acc)
+{
+	int	lanes[4];
+
+	_mm_storeu_si128((__m128i *)lanes, acc);
+	return (lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+int	scan_sse2(t_scan *scan)
+{
+	__m128i	limit;
+	__m128i	goal;
+	__m128i	acc;
+	int		mask;
+	int		i;
+
+	limit = _mm_set1_epi32(scan->limit);
+	goal = _mm_set1_epi32(scan->goal);
+	acc = _mm_setzero_si128();
+	i = 0;
+	while (i < scan->n)
+	{
+		mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(
+						_mm_load_si128((const __m128i *)(scan->times + i)),
+						limit)));
+		if (mask)
+			return (i + __builtin_ctz(mask));
+		acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(
+					_mm_load_si128((const __m128i *)(scan->meals + i)), goal));
+		i += 4;
+	}
+	scan->finished += scan_hsum128(acc);
+	return (-1);
+}
+
+__attribute__((target("avx2")))
+static int	scan_hsum256(__m256i acc)
+{
+	return (scan_hsum128(_mm_add_epi32(_mm256_castsi256_si128(acc),
+				_mm256_extracti128_si256(acc, 1))));
+}
+
+__attribute__((target("avx2")))
+int	scan_avx2(t_scan *scan)
+{
+	__m256i	limit;
+	__m256i	goal;
+	__m256i	acc;
+	int		mask;
+	int		i;
+
+	limit = _mm256_set1_epi32(scan->limit);
+	goal = _mm256_set1_epi32(scan->goal);
+	acc = _mm256_setzero_si256();
+	i = 0;
+	while (i < scan->n)
+	{
+		mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(
+						limit,
+						_mm256_load_si256((const __m256i *)(scan->times + i)))));
+		if (mask)
+			return (i + __builtin_ctz(mask));
+		acc = _mm256_sub_epi32(acc, _mm256_cmpgt_epi32(_mm256_load_si256(
+						(const __m256i *)(scan->meals + i)), goal));
+		i += 8;
+	}
+	scan->finished += scan_hsum256(acc);
+	return (-1);
+}
+
+__attribute__((target("avx512f")))
+int	scan_avx512(t_scan *scan)
+{
+	__m512i		limit;
+	__m512i		goal;
+	__mmask16	mask;
+	int			i;
+
+	limit = _mm512_set1_epi32(scan->limit);
+	goal = _mm512_set1_epi32(scan->goal);
+	i = 0;
+	while (i < scan->n)
+	{
+		mask = _mm512_cmplt_epi32_mask(_mm512_load_si512(scan->times + i),
+				limit);
+		if (mask)
+			return (i + __builtin_ctz(mask));
+		scan->finished += __builtin_popcount(_mm512_cmpgt_epi32_mask(
+					_mm512_load_si512(scan->meals + i), goal));
+		i += 16;
+	}
+	return (-1);
+}
+
+#endif
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   table.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 09:48:36 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/22 09:48:36 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/philo.h"
+
+/**
+ * @brief Accède au philosophe d'index i (base 0)
+ *
+ * Les philosophes sont rangés par blocs de CHUNK_SIZE : l'adresse d'un
+ * philosophe ne change jamais, même quand la table grandit.
+ */
+t_philo	*philo_at(t_data *data, int i)
+{
+	return (&data->philos[i / CHUNK_SIZE][i % CHUNK_SIZE]);
+}
+
+/**
+ * @brief Accède au mutex de la fourchette d'index f
+ */
+pthread_mutex_t	*fork_at(t_data *data, int f)
+{
+	return (&data->forks[f / CHUNK_SIZE][f % CHUNK_SIZE]);
+}
+
+/**
+ * @brief Alloue le bloc c de philosophes et des tableaux du scan
+ *
+ * @param data Structure principale
+ * @param c Index du bloc
+ * @return int 1 si l'allocation réussit, 0 sinon
+ *
+ * Toutes les cases du scan démarrent neutres (jamais expirées, jamais
+ * rassasiées) : une case n'est prise en compte qu'une fois publiée par
+ * scan_publish().
+ */
+static int	table_chunk(t_data *data, int c)
+{
+	int	i;
+
+	data->philos[c] = malloc(sizeof(t_philo) * CHUNK_SIZE);
+	data->meal_times[c] = aligned_alloc(SCAN_ALIGN, sizeof(int) * CHUNK_SIZE);
+	data->meal_counts[c] = aligned_alloc(SCAN_ALIGN, sizeof(int) * CHUNK_SIZE);
+	if (!data->philos[c] || !data->meal_times[c] || !data->meal_counts[c])
+		return (0);
+	i = 0;
+	while (i < CHUNK_SIZE)
+	{
+		data->meal_times[c][i] = INT_MAX;
+		data->meal_counts[c][i] = INT_MIN;
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Garantit la place pour n philosophes
+ *
+ * @param data Structure principale
+ * @param n Nombre de cases de philosophes nécessaires
+ * @return int 1 si la place existe, 0 si la capacité ou la mémoire manque
+ *
+ * Seuls les blocs manquants sont alloués ; ceux qui existent, déjà lus
+ * par les autres threads, ne sont ni déplacés ni copiés.
+ */
+int	table_philos(t_data *data, int n)
+{
+	int	c;
+
+	if (n > CHUNK_SIZE * CHUNK_MAX)
+		return (0);
+	c = 0;
+	while (c * CHUNK_SIZE < n)
+	{
+		if (!data->philos[c] && !table_chunk(data, c))
+			return (0);
+		c++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Crée les fourchettes d'index first à n - 1
+ *
+ * @param data Structure principale
+ * @param first Première fourchette à initialiser
+ * @param n Nombre total de fourchettes après l'appel
+ * @return int 1 si l'initialisation réussit, 0 en cas d'erreur
+ *
+ * Ne modifie pas nb_forks : l'appelant le met à jour une fois les
+ * mutex prêts.
+ */
+int	table_forks(t_data *data, int first, int n)
+{
+	int	c;
+
+	if (n > CHUNK_SIZE * CHUNK_MAX)
+		return (0);
+	while (first < n)
+	{
+		c = first / CHUNK_SIZE;
+		if (!data->forks[c])
+			data->forks[c] = malloc(sizeof(pthread_mutex_t) * CHUNK_SIZE);
+		if (!data->forks[c] || pthread_mutex_init(fork_at(data, first), NULL))
+			return (0);
+		first++;
+	}
+	return (1);
+}
@@ -141,18 +141,53 @@ void	ft_usleep(int ms)
  * - current_time = temps_actuel - temps_début_simulation
  * - Donne un temps relatif depuis le démarrage
  * - Plus facile à interpréter que les timestamps Unix absolus
+ *
+ * Instrumentation (make perf) : le temps passé ici, attente de
+ * print_mutex comprise, est attribué à la phase PH_LOG puis la phase
+ * de l'appelant est restaurée.
  */
 void	print_status(t_philo *philo, char *status)
+{
+	t_phase		prev;
+
+	prev = perf_enter(&philo->perf, PH_LOG);
+	print_event(philo->data, philo->id, status);
+	perf_enter(&philo->perf, prev);
+}
+
+/**
+ * @brief Affiche une ligne de statut pour le philosophe id
+ *
+ * @param data Structure principale
+ * @param id Identifiant affiché du philosophe
+ * @param status Chaîne décrivant l'action
+ *
+ * Même format et mêmes garanties que print_status(), sans
+ * instrumentation : utilisable depuis un autre thread que celui du
+ * philosophe (canal de contrôle : "has joined", "has left").
+ */
+void	print_event(t_data *data, int id, char *status)
+{
+	pthread_mutex_lock(&data->print_mutex);
+	print_line(data, id, status);
+	pthread_mutex_unlock(&data->print_mutex);
+}
+
+/**
+ * @brief Affiche une ligne de statut, print_mutex déjà tenu
+ *
+ * Pour enchaîner un affichage avec une autre action sans qu'une ligne
+ * d'un autre thread s'intercale (arrivée d'un philosophe).
+ */
+void	print_line(t_data *data, int id, char *status)
 {
 	long long	current_time;
 
-	pthread_mutex_lock(&philo->data->print_mutex);
-	pthread_mutex_lock(&philo->data->dead_mutex);
-	if (!philo->data->dead)
+	pthread_mutex_lock(&data->dead_mutex);
+	if (!data->dead)
 	{
-		current_time = get_time() - philo->data->start_time;
-		printf("%lld %d %s\n", current_time, philo->id, status);
+		current_time = get_time() - data->start_time;
+		printf("%lld %d %s\n", current_time, id, status);
 	}
-	pthread_mutex_unlock(&philo->data->dead_mutex);
-	pthread_mutex_unlock(&philo->data->print_mutex);
+	pthread_mutex_unlock(&data->dead_mutex);
 }
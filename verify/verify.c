@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   verify.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 11:12:37 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/26 11:12:37 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "verify.h"
+#include <string.h>
+
+/**
+ * @brief Vérifie un journal ouvert et l'ajoute au bilan
+ *
+ * @return int 1 si le journal a été lu, 0 si la mémoire manque
+ */
+static int	verify_file(t_verify *v, const char *name, FILE *f)
+{
+	t_log	log;
+	int		ok;
+
+	ok = log_read(&log, f, v->ttd);
+	if (ok)
+		report_log(v, name, &log);
+	log_free(&log);
+	return (ok);
+}
+
+/**
+ * @brief Vérifie les journaux de ./philo
+ *
+ * ./philo_verify time_to_die [journal ...]
+ * Sans journal, lit l'entrée standard : ./philo 4 310 200 100 |
+ * ./philo_verify 310. Pour chaque journal : instant de la mort affichée
+ * contre l'instant réel, lignes après la mort, morts jamais affichées.
+ * Puis le bilan et les centiles de latence de tous les journaux.
+ *
+ * @return int 0 si tous les journaux respectent le contrat, 1 sinon
+ */
+int	main(int argc, char **argv)
+{
+	t_verify	v;
+	FILE		*f;
+	int			i;
+
+	if (argc < 2 || atoi(argv[1]) <= 0)
+	{
+		fprintf(stderr, "usage: %s time_to_die [log ...]\n", argv[0]);
+		return (2);
+	}
+	memset(&v, 0, sizeof(v));
+	v.ttd = atoi(argv[1]);
+	v.lat = malloc(sizeof(long long) * (argc + 1));
+	if (!v.lat)
+		return (2);
+	if (argc == 2 && !verify_file(&v, "stdin", stdin))
+		return (2);
+	i = 1;
+	while (++i < argc)
+	{
+		f = fopen(argv[i], "r");
+		if (!f)
+			perror(argv[i]);
+		v.bad += !f;
+		if (f && !verify_file(&v, argv[i], f))
+			return (2);
+		if (f)
+			fclose(f);
+	}
+	report_total(&v);
+	free(v.lat);
+	return (v.late || v.early || v.after || v.starved || v.unreported
+		|| v.bad);
+}
@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   verify.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 09:32:10 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/26 09:32:10 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VERIFY_H
+# define VERIFY_H
+
+# include <stdio.h>
+# include <stdlib.h>
+
+/* Délai maximal entre la mort réelle et son affichage (sujet) */
+# define VERIFY_LATE_MS 10
+# define VERIFY_LINE 256
+
+/* Un journal de ./philo rejoué ligne par ligne */
+typedef struct s_log
+{
+	long long	*last;
+	char		*active;
+	int			cap;
+	int			ttd;
+	int			died_id;
+	long long	died_ts;
+	long long	due;
+	long long	end;
+	int			after;
+	int			starved;
+	int			bad;
+}				t_log;
+
+/* Bilan de tous les journaux vérifiés */
+typedef struct s_verify
+{
+	int			ttd;
+	long long	*lat;
+	int			nb_lat;
+	int			runs;
+	int			late;
+	int			early;
+	int			after;
+	int			starved;
+	int			unreported;
+	int			bad;
+}				t_verify;
+
+/* verify_log.c */
+int			log_read(t_log *log, FILE *f, int ttd);
+void		log_free(t_log *log);
+
+/* verify_report.c */
+void		report_log(t_verify *v, const char *name, t_log *log);
+void		report_total(t_verify *v);
+
+#endif
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   verify_log.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 09:58:41 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/26 09:58:41 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "verify.h"
+#include <string.h>
+
+/**
+ * @brief Garantit une case pour le philosophe id
+ *
+ * @return int 1 si la case existe, 0 si la mémoire manque
+ *
+ * active : 0 jamais vu, 1 présent, 2 parti.
+ */
+static int	log_grow(t_log *log, int id)
+{
+	int	cap;
+
+	if (id < log->cap)
+		return (1);
+	cap = log->cap * 2 + 64;
+	while (cap <= id)
+		cap *= 2;
+	log->last = realloc(log->last, sizeof(long long) * cap);
+	log->active = realloc(log->active, cap);
+	if (!log->last || !log->active)
+		return (0);
+	memset(log->last + log->cap, 0, sizeof(long long) * (cap - log->cap));
+	memset(log->active + log->cap, 0, cap - log->cap);
+	log->cap = cap;
+	return (1);
+}
+
+/**
+ * @brief Échéance la plus proche parmi les philosophes présents
+ *
+ * Au moment où une mort est affichée, c'est l'instant où la première
+ * mort a réellement eu lieu (dernier repas + time_to_die).
+ */
+static long long	log_due(t_log *log, int ttd)
+{
+	long long	due;
+	int			id;
+
+	due = -1;
+	id = 1;
+	while (id < log->cap)
+	{
+		if (log->active[id] == 1 && (due < 0 || log->last[id] + ttd < due))
+			due = log->last[id] + ttd;
+		id++;
+	}
+	return (due);
+}
+
+/**
+ * @brief Applique une ligne "timestamp id message"
+ *
+ * - "is eating" : un écart de plus de time_to_die depuis le repas
+ *   précédent est une mort qui n'a pas été affichée (starved)
+ * - "has joined" / "has left" : arrivée et départ (canal de contrôle)
+ * - "died" : mémorise l'instant affiché et l'échéance réelle
+ * - toute ligne après "died" est comptée dans after
+ * Un philosophe vu pour la première fois sans "has joined" est un
+ * philosophe initial : présent, dernier repas à 0.
+ */
+static void	log_line(t_log *log, long long ts, int id, const char *msg)
+{
+	if (!log->active[id])
+		log->active[id] = 1;
+	if (log->died_id >= 0)
+		log->after++;
+	else if (strcmp(msg, "is eating") == 0)
+	{
+		if (ts - log->last[id] > log->ttd)
+			log->starved++;
+		log->last[id] = ts;
+	}
+	else if (strcmp(msg, "has joined") == 0)
+	{
+		log->last[id] = ts;
+		log->active[id] = 1;
+	}
+	else if (strcmp(msg, "has left") == 0)
+		log->active[id] = 2;
+	else if (strcmp(msg, "died") == 0)
+	{
+		log->died_id = id;
+		log->died_ts = ts;
+	}
+	else if (strcmp(msg, "has taken a fork") && strcmp(msg, "is sleeping")
+		&& strcmp(msg, "is thinking"))
+		log->bad++;
+	if (ts > log->end)
+		log->end = ts;
+}
+
+/**
+ * @brief Rejoue un journal complet
+ *
+ * @param log Reçoit l'état final du journal
+ * @param f Journal ouvert en lecture
+ * @param ttd time_to_die de la simulation (ms)
+ * @return int 1 si le journal a été lu, 0 si la mémoire manque
+ *
+ * log->due reçoit l'échéance réelle de la première mort, -1 si personne
+ * n'a dépassé time_to_die. Un journal coupé sans "died" (arrêt
+ * par timeout) n'est suspect que si une échéance est dépassée de plus de
+ * VERIFY_LATE_MS : l'affichage avait encore le temps d'arriver. Une
+ * dernière ligne sans '\n' (processus tué en cours d'écriture) est
+ * ignorée.
+ */
+int	log_read(t_log *log, FILE *f, int ttd)
+{
+	char		line[VERIFY_LINE];
+	char		msg[VERIFY_LINE];
+	long long	ts;
+	int			id;
+
+	memset(log, 0, sizeof(*log));
+	log->died_id = -1;
+	log->ttd = ttd;
+	while (fgets(line, sizeof(line), f))
+	{
+		if (!strchr(line, '\n') && feof(f))
+			break ;
+		if (sscanf(line, "%lld %d %[^\n]", &ts, &id, msg) != 3 || id <= 0)
+			log->bad++;
+		else if (!log_grow(log, id))
+			return (0);
+		else
+			log_line(log, ts, id, msg);
+	}
+	log->due = log_due(log, ttd);
+	if (log->died_id < 0 && log->due >= 0
+		&& log->end - log->due <= VERIFY_LATE_MS)
+		log->due = -1;
+	return (1);
+}
+
+void	log_free(t_log *log)
+{
+	free(log->last);
+	free(log->active);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   verify_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luda-cun <luda-cun@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 10:41:05 by luda-cun          #+#    #+#             */
+/*   Updated: 2025/09/26 10:41:05 by luda-cun         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "verify.h"
+
+/**
+ * @brief Résume un journal et l'ajoute au bilan
+ *
+ * @param v Bilan global
+ * @param name Nom du journal
+ * @param log Journal rejoué par log_read()
+ *
+ * Latence = instant affiché - échéance réelle (dernier repas affiché +
+ * time_to_die). Elle est négative si la mort est affichée trop tôt,
+ * supérieure à VERIFY_LATE_MS si elle est affichée trop tard.
+ */
+void	report_log(t_verify *v, const char *name, t_log *log)
+{
+	long long	lat;
+
+	v->runs++;
+	v->after += log->after;
+	v->starved += log->starved;
+	v->bad += log->bad;
+	printf("%s:", name);
+	if (log->died_id >= 0)
+	{
+		lat = log->died_ts - log->due;
+		v->lat[v->nb_lat++] = lat;
+		v->late += (lat > VERIFY_LATE_MS);
+		v->early += (lat < 0);
+		printf(" %d died at %lld, due %lld (%+lld ms)", log->died_id,
+			log->died_ts, log->due, lat);
+		if (lat > VERIFY_LATE_MS)
+			printf(" LATE");
+		if (lat < 0)
+			printf(" EARLY");
+	}
+	else if (log->due >= 0)
+	{
+		v->unreported++;
+		printf(" death due at %lld never reported", log->due);
+	}
+	else
+		printf(" no death");
+	if (log->after)
+		printf(", %d line(s) after death", log->after);
+	if (log->starved)
+		printf(", %d meal(s) after time_to_die", log->starved);
+	if (log->bad)
+		printf(", %d unreadable line(s)", log->bad);
+	printf("\n");
+}
+
+static int	cmp_ll(const void *a, const void *b)
+{
+	long long	x;
+	long long	y;
+
+	x = *(const long long *)a;
+	y = *(const long long *)b;
+	return ((x > y) - (x < y));
+}
+
+/**
+ * @brief Centile p (rang le plus proche) d'un tableau trié
+ */
+static long long	percentile(long long *v, int n, int p)
+{
+	int	rank;
+
+	rank = (p * n + 99) / 100;
+	if (rank < 1)
+		rank = 1;
+	return (v[rank - 1]);
+}
+
+/**
+ * @brief Affiche le bilan et les centiles de latence
+ */
+void	report_total(t_verify *v)
+{
+	printf("runs %d, deaths %d, late %d, early %d, lines after death %d, "
+		"meals after time_to_die %d, unreported deaths %d, unreadable %d\n",
+		v->runs, v->nb_lat, v->late, v->early, v->after, v->starved,
+		v->unreported, v->bad);
+	if (v->nb_lat == 0)
+		return ;
+	qsort(v->lat, v->nb_lat, sizeof(long long), cmp_ll);
+	printf("death report latency (ms): min %lld p50 %lld p90 %lld "
+		"p99 %lld max %lld\n", v->lat[0], percentile(v->lat, v->nb_lat, 50),
+		percentile(v->lat, v->nb_lat, 90), percentile(v->lat, v->nb_lat, 99),
+		v->lat[v->nb_lat - 1]);
+}